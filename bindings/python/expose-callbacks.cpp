@@ -1,4 +1,5 @@
 #include "proxsuite-nlp/python/fwd.hpp"
+#include "proxsuite-nlp/python/gil.hpp"
 #include "proxsuite-nlp/helpers-base.hpp"
 #include "proxsuite-nlp/helpers/history-callback.hpp"
 
@@ -9,8 +10,10 @@ namespace python {
 struct CallbackWrapper : helpers::base_callback<context::Scalar>,
                          bp::wrapper<helpers::base_callback<context::Scalar>> {
   CallbackWrapper() = default;
+  /// The workspace and results are passed by reference, without copies.
   void call(const context::Workspace &w, const context::Results &r) {
-    this->get_override("call")(w, r);
+    ScopedAcquireGIL gil;
+    this->get_override("call")(boost::ref(w), boost::ref(r));
   }
 };
 
@@ -21,7 +24,13 @@ void exposeCallbacks() {
   bp::register_ptr_to_python<shared_ptr<callback_t>>();
 
   bp::class_<CallbackWrapper, shared_ptr<CallbackWrapper>, boost::noncopyable>(
-      "BaseCallback", "Base callback for solvers.", bp::init<>())
+      "BaseCallback",
+      "Base callback for solvers. The workspace and results are passed to "
+      "`call()` by reference, and their vector and matrix buffers (e.g. "
+      "`workspace.kkt_matrix`, `results.xopt`) are read-only NumPy views of "
+      "the solver data: they are not copied, and should be copied to be kept "
+      "across iterations.",
+      bp::init<>())
       .def("call", bp::pure_virtual(&CallbackWrapper::call),
            bp::args("self", "workspace", "results"));
 
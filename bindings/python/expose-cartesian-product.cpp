@@ -11,6 +11,7 @@ using context::Manifold;
 using context::Scalar;
 using PolymorphicManifold = polymorphic<Manifold>;
 using context::ConstVectorRef;
+using context::MatrixXs;
 using context::VectorRef;
 using context::VectorXs;
 using CartesianProduct = CartesianProductTpl<Scalar>;
@@ -55,6 +56,36 @@ void exposeCartesianProduct() {
            ("self"_a, "c"), "Add a component to the Cartesian product.")
       .add_property("num_components", &CartesianProduct::numComponents,
                     "Get the number of components in the Cartesian product.")
+      .def("nxOffset", &CartesianProduct::nxOffset, ("self"_a, "i"),
+           "Offset of the i-th component in the points of the product.")
+      .def("ndxOffset", &CartesianProduct::ndxOffset, ("self"_a, "i"),
+           "Offset of the i-th component in the tangent vectors of the "
+           "product.")
+      .add_property("max_component_ndx", &CartesianProduct::maxComponentNdx,
+                    "Largest tangent dimension of the components.")
+      .def(
+          "Jintegrate_blocks",
+          +[](const CartesianProduct &m, const ConstVectorRef &x,
+              const ConstVectorRef &v, int arg) {
+            MatrixXs Jblocks(m.ndx(), m.maxComponentNdx());
+            m.Jintegrate_blocks(x, v, Jblocks, arg);
+            return Jblocks;
+          },
+          ("self"_a, "x", "v", "arg"),
+          "Diagonal blocks of the Jacobian of integrate(), stacked "
+          "vertically: the block of the i-th component lies in its rows and "
+          "its first ndx columns.")
+      .def(
+          "Jdifference_blocks",
+          +[](const CartesianProduct &m, const ConstVectorRef &x0,
+              const ConstVectorRef &x1, int arg) {
+            MatrixXs Jblocks(m.ndx(), m.maxComponentNdx());
+            m.Jdifference_blocks(x0, x1, Jblocks, arg);
+            return Jblocks;
+          },
+          ("self"_a, "x0", "x1", "arg"),
+          "Diagonal blocks of the Jacobian of difference(), see "
+          "Jintegrate_blocks().")
       .def(
           "split",
           +[](CartesianProduct const &m, const ConstVectorRef &x) {
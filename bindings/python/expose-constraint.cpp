@@ -130,6 +130,20 @@ static void exposeConstraintTypes() {
                                          "1-norm penalty function.")
       .def(bp::init<>(("self"_a)));
 
+  exposeSpecificConstraintSet<SecondOrderConeTpl<Scalar>>(
+      "SecondOrderCone",
+      "Second-order cone :math:`\\{(t, x) : \\|x\\| \\leq t\\}`, where "
+      ":math:`t` is the first component.")
+      .def(bp::init<>(("self"_a)));
+
+  exposeSpecificConstraintSet<PositiveSemidefiniteConeTpl<Scalar>>(
+      "PositiveSemidefiniteCone",
+      "Cone of positive semidefinite matrices, in column-major vectorized "
+      "form.")
+      .def(bp::init<int>(("self"_a, "n")))
+      .add_property("n", &PositiveSemidefiniteConeTpl<Scalar>::n,
+                    "Matrix size.");
+
   exposeSpecificConstraintSet<ConstraintSetProduct>(
       "ConstraintSetProduct", "Cartesian product of constraint sets.")
       .def(bp::init<std::vector<polymorphic<ConstraintSet>>,
@@ -141,7 +155,12 @@ static void exposeConstraintTypes() {
       .add_property("blockSizes",
                     bp::make_function(&ConstraintSetProduct::blockSizes,
                                       bp::return_internal_reference<>()),
-                    "Dimensions of each component of the cartesian product.");
+                    "Dimensions of each component of the cartesian product.")
+      .add_property("blockOffsets",
+                    bp::make_function(&ConstraintSetProduct::blockOffsets,
+                                      bp::return_internal_reference<>()),
+                    "Start index of each component, followed by the total "
+                    "dimension.");
 
   StdVectorPythonVisitor<std::vector<polymorphic<ConstraintSet>>>::expose(
       "StdVec_ConstraintObject",
@@ -1,5 +1,6 @@
 
 #include "proxsuite-nlp/python/fwd.hpp"
+#include "proxsuite-nlp/python/gil.hpp"
 #include "proxsuite-nlp/cost-function.hpp"
 #include "proxsuite-nlp/cost-sum.hpp"
 
@@ -24,11 +25,16 @@ struct CostWrapper : Cost, bp::wrapper<Cost> {
 
   using Cost::Cost;
 
-  Scalar call(const ConstVectorRef &x) const { return get_override("call")(x); }
+  Scalar call(const ConstVectorRef &x) const {
+    ScopedAcquireGIL gil;
+    return get_override("call")(x);
+  }
   void computeGradient(const ConstVectorRef &x, VectorRef out) const {
+    ScopedAcquireGIL gil;
     get_override("computeGradient")(x, out);
   }
   void computeHessian(const ConstVectorRef &x, MatrixRef out) const {
+    ScopedAcquireGIL gil;
     get_override("computeHessian")(x, out);
   }
 };
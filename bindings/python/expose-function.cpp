@@ -1,6 +1,7 @@
 #include "proxsuite-nlp/python/function.hpp"
 #include "proxsuite-nlp/function-ops.hpp"
 #include "proxsuite-nlp/manifold-base.hpp"
+#include "proxsuite-nlp/evaluation-cache.hpp"
 
 namespace proxsuite {
 namespace nlp {
@@ -25,21 +26,35 @@ void exposeFunctionTypes() {
            bp::args("self", "x"), "Call the function.")
       .add_property("nx", &Function::nx, "Input dimension")
       .add_property("ndx", &Function::ndx, "Input tangent space dimension.")
-      .add_property("nr", &Function::nr, "Function codimension.");
+      .add_property("nr", &Function::nr, "Function codimension.")
+      .add_property("thread_safe", &Function::isThreadSafe,
+                    &Function::setThreadSafe,
+                    "Whether the function may be evaluated concurrently.");
 
   context::MatFuncType C1Function::*compJac1 = &C1Function::computeJacobian;
   context::MatFuncRetType C1Function::*compJac2 = &C1Function::computeJacobian;
 
+  // __call__() and computeJacobian() may be implemented by the combined
+  // evaluate_all() protocol, hence they are not pure virtual here
   bp::class_<C1FunctionWrap, bp::bases<Function>, boost::noncopyable>(
-      "C1Function", "Base class for differentiable functions", bp::no_init)
+      "C1Function",
+      "Base class for differentiable functions. Subclasses override either "
+      "`__call__` and `computeJacobian`, or the combined protocol "
+      "`evaluate_all(x, out_value, out_jac, lam, out_vhp)`, which fills the "
+      "preallocated outputs that are not None in a single call.",
+      bp::no_init)
       .def(bp::init<const Manifold &, const int>(
           bp::args("self", "manifold", "nr")))
       .def(bp::init<int, int, int>(bp::args("self", "nx", "ndx", "nr")))
-      .def("computeJacobian", bp::pure_virtual(compJac1),
-           bp::args("self", "x", "Jout"))
+      .def("__call__", &C1Function::operator(), bp::args("self", "x"),
+           "Call the function.")
+      .def("computeJacobian", compJac1, bp::args("self", "x", "Jout"))
       .def("getJacobian", compJac2, bp::args("self", "x"),
            "Compute and return Jacobian.");
 
+  // the wrapper only looks for overrides below the class it is registered
+  // with: without these definitions, the C1Function methods would be taken
+  // for Python overrides, and dispatch back to the wrapper forever
   bp::register_ptr_to_python<shared_ptr<C2Function>>();
   bp::class_<C2FunctionWrap, bp::bases<C1Function>, boost::noncopyable>(
       "C2Function", "Base class for twice-differentiable functions.",
@@ -47,6 +62,9 @@ void exposeFunctionTypes() {
       .def(bp::init<const Manifold &, const int>(
           bp::args("self", "manifold", "nr")))
       .def(bp::init<int, int, int>(bp::args("self", "nx", "ndx", "nr")))
+      .def("__call__", &C2Function::operator(), bp::args("self", "x"),
+           "Call the function.")
+      .def("computeJacobian", compJac1, bp::args("self", "x", "Jout"))
       .def("vectorHessianProduct", &C2Function::vectorHessianProduct,
            &C2FunctionWrap::default_vhp, bp::args("self", "x", "v", "Hout"))
       .def("getVHP", &C2FunctionWrap::getVHP, bp::args("self", "x", "v"),
@@ -60,6 +78,15 @@ void exposeFunctionTypes() {
           "Composition operator. This composes the first argument over the "
           "second one.");
 
+  bp::class_<EvaluationCacheBase, shared_ptr<EvaluationCacheBase>,
+             boost::noncopyable>(
+      "EvaluationCache",
+      "Base class for quantities shared by the functions of a problem at an "
+      "evaluation point.",
+      bp::no_init)
+      .def("invalidate", &EvaluationCacheBase::invalidate, bp::args("self"),
+           "Mark the cached quantities as outdated.");
+
   exposeFunctionOps();
 }
 
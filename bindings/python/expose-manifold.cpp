@@ -17,6 +17,7 @@
 namespace proxsuite {
 namespace nlp {
 namespace python {
+using context::ConstMatrixRef;
 using context::ConstVectorRef;
 using context::Manifold;
 using context::MatrixRef;
@@ -37,10 +38,29 @@ void exposeManifoldBase() {
   using JacobianFunType = void (Manifold::*)(
       const ConstVectorRef &, const ConstVectorRef &, MatrixRef, int) const;
 
+  bp::enum_<JacobianStructure>(
+      "JacobianStructure",
+      "Structure of the Jacobians of the manifold operations.")
+      .value("DENSE", JacobianStructure::DENSE)
+      .value("BLOCK_DIAGONAL", JacobianStructure::BLOCK_DIAGONAL)
+      .value("IDENTITY", JacobianStructure::IDENTITY);
+
   bp::class_<Manifold, boost::noncopyable>(
       "ManifoldAbstract", "Manifold abstract class.", bp::no_init)
       .add_property("nx", &Manifold::nx, "Manifold representation dimension.")
       .add_property("ndx", &Manifold::ndx, "Tangent space dimension.")
+      .add_property("jacobian_structure", &Manifold::jacobianStructure,
+                    "Structure of the Jacobians of integrate() and "
+                    "difference().")
+      .add_property(
+          "jacobian_blocks",
+          +[](const Manifold &m) {
+            bp::list blocks;
+            for (int n : m.jacobianBlocks())
+              blocks.append(n);
+            return blocks;
+          },
+          "Tangent dimensions of the diagonal blocks of the Jacobians.")
       .def("neutral", &Manifold::neutral, "self"_a,
            "Get the neutral point from the manifold (if a Lie group).")
       .def("rand", &Manifold::rand, "self"_a,
@@ -97,6 +117,64 @@ void exposeManifoldBase() {
           },
           ("self"_a, "x0", "x1", "arg"),
           "Compute and return the Jacobian of the log.")
+      .def("integrate_batch", &Manifold::integrate_batch,
+           ("self"_a, "X", "V", "Xout"),
+           "Integrate each column of V at the corresponding column of X.")
+      .def(
+          "integrate_batch",
+          +[](const Manifold &m, const ConstMatrixRef &X,
+              const ConstMatrixRef &V) {
+            MatrixXs Xout(m.nx(), X.cols());
+            m.integrate_batch(X, V, Xout);
+            return Xout;
+          },
+          ("self"_a, "X", "V"),
+          "Integrate each column of V at the corresponding column of X. "
+          "Allocated version.")
+      .def("difference_batch", &Manifold::difference_batch,
+           ("self"_a, "X0", "X1", "Vout"),
+           "Difference between the corresponding columns of X0 and X1.")
+      .def(
+          "difference_batch",
+          +[](const Manifold &m, const ConstMatrixRef &X0,
+              const ConstMatrixRef &X1) {
+            MatrixXs Vout(m.ndx(), X0.cols());
+            m.difference_batch(X0, X1, Vout);
+            return Vout;
+          },
+          ("self"_a, "X0", "X1"),
+          "Difference between the corresponding columns of X0 and X1. "
+          "Allocated version.")
+      .def("Jintegrate_batch", &Manifold::Jintegrate_batch,
+           ("self"_a, "X", "V", "Jout", "arg"),
+           "Jacobians of the exp operator at each column, stacked "
+           "horizontally.")
+      .def(
+          "Jintegrate_batch",
+          +[](const Manifold &m, const ConstMatrixRef &X,
+              const ConstMatrixRef &V, int arg) {
+            MatrixXs Jout(m.ndx(), m.ndx() * X.cols());
+            m.Jintegrate_batch(X, V, Jout, arg);
+            return Jout;
+          },
+          ("self"_a, "X", "V", "arg"),
+          "Compute and return the Jacobians of the exp operator at each "
+          "column, stacked horizontally.")
+      .def("Jdifference_batch", &Manifold::Jdifference_batch,
+           ("self"_a, "X0", "X1", "Jout", "arg"),
+           "Jacobians of the log operator at each column, stacked "
+           "horizontally.")
+      .def(
+          "Jdifference_batch",
+          +[](const Manifold &m, const ConstMatrixRef &X0,
+              const ConstMatrixRef &X1, int arg) {
+            MatrixXs Jout(m.ndx(), m.ndx() * X0.cols());
+            m.Jdifference_batch(X0, X1, Jout, arg);
+            return Jout;
+          },
+          ("self"_a, "X0", "X1", "arg"),
+          "Compute and return the Jacobians of the log operator at each "
+          "column, stacked horizontally.")
       .def("tangent_space", &Manifold::tangentSpace, bp::args("self"),
            "Returns an object representing the tangent space to this manifold.")
       .def(
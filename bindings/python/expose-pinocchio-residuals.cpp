@@ -2,6 +2,7 @@
 #include "proxsuite-nlp/python/residuals.hpp"
 
 #include "proxsuite-nlp/modelling/residuals/rigid-transform-point.hpp"
+#include "proxsuite-nlp/modelling/residuals/multibody-residuals.hpp"
 
 namespace proxsuite {
 namespace nlp {
@@ -22,6 +23,85 @@ void exposePinocchioResiduals() {
                     "Function input space.")
       .def_readwrite("point", &RigidTransformPointAction::point_)
       .add_property("skew_matrix", &RigidTransformPointAction::skew_point);
+
+  using MultibodyDataCache = MultibodyDataCacheTpl<Scalar>;
+  bp::class_<MultibodyDataCache, bp::bases<EvaluationCacheBase>,
+             shared_ptr<MultibodyDataCache>, boost::noncopyable>(
+      "MultibodyDataCache",
+      "Pinocchio data holding the kinematics of a model at the last "
+      "evaluation point, shared by the multibody residuals of a problem.",
+      bp::init<const MultibodyDataCache::ModelType &>(
+          bp::args("self", "model")))
+      .add_property("model",
+                    bp::make_function(&MultibodyDataCache::getModel,
+                                      bp::return_internal_reference<>()))
+      .def("kinematics", &MultibodyDataCache::kinematics,
+           bp::return_internal_reference<>(), bp::args("self", "x"),
+           "Joint and frame placements at the configuration x.")
+      .def("jacobians", &MultibodyDataCache::jacobians,
+           bp::return_internal_reference<>(), bp::args("self", "x"),
+           "Placements and joint Jacobians at the configuration x.")
+      .add_property("num_kinematics_passes",
+                    &MultibodyDataCache::numKinematicsPasses)
+      .add_property("num_jacobians_passes",
+                    &MultibodyDataCache::numJacobiansPasses);
+
+  using MultibodyResidualBase = MultibodyResidualBaseTpl<Scalar>;
+  using ConfigSpace = MultibodyResidualBase::ConfigSpace;
+  using PhaseSpace = MultibodyResidualBase::PhaseSpace;
+  using CachePtr = shared_ptr<MultibodyDataCache>;
+  bp::class_<MultibodyResidualBase, bp::bases<context::C2Function>,
+             boost::noncopyable>(
+      "MultibodyResidualBase",
+      "Base class for residuals of the configuration of a multibody, defined "
+      "on MultibodyConfiguration or MultibodyPhaseSpace.",
+      bp::no_init)
+      .add_property("model",
+                    bp::make_function(&MultibodyResidualBase::getModel,
+                                      bp::return_internal_reference<>()))
+      .add_property("cache",
+                    bp::make_function(&MultibodyResidualBase::getCache,
+                                      bp::return_value_policy<
+                                          bp::copy_const_reference>()),
+                    "Data cache read by the residual.");
+
+  using FramePlacement = FramePlacementResidualTpl<Scalar>;
+  using SE3 = FramePlacement::SE3;
+  bp::class_<FramePlacement, bp::bases<MultibodyResidualBase>>(
+      "FramePlacementResidual",
+      "Placement error :math:`\\log(\\bar{M}^{-1} M_f(q))` of a frame.",
+      bp::init<const ConfigSpace &, pin::FrameIndex, const SE3 &,
+               bp::optional<CachePtr>>(
+          ("self"_a, "space", "frame_id", "target", "cache")))
+      .def(bp::init<const PhaseSpace &, pin::FrameIndex, const SE3 &,
+                    bp::optional<CachePtr>>(
+          ("self"_a, "space", "frame_id", "target", "cache")))
+      .def_readonly("frame_id", &FramePlacement::frame_id_)
+      .def_readwrite("target", &FramePlacement::target_);
+
+  using FrameTranslation = FrameTranslationResidualTpl<Scalar>;
+  bp::class_<FrameTranslation, bp::bases<MultibodyResidualBase>>(
+      "FrameTranslationResidual",
+      "Position error :math:`p_f(q) - \\bar{p}` of the origin of a frame.",
+      bp::init<const ConfigSpace &, pin::FrameIndex, const context::Vector3s &,
+               bp::optional<CachePtr>>(
+          ("self"_a, "space", "frame_id", "target", "cache")))
+      .def(bp::init<const PhaseSpace &, pin::FrameIndex,
+                    const context::Vector3s &, bp::optional<CachePtr>>(
+          ("self"_a, "space", "frame_id", "target", "cache")))
+      .def_readonly("frame_id", &FrameTranslation::frame_id_)
+      .def_readwrite("target", &FrameTranslation::target_);
+
+  using CenterOfMass = CenterOfMassResidualTpl<Scalar>;
+  bp::class_<CenterOfMass, bp::bases<MultibodyResidualBase>>(
+      "CenterOfMassResidual",
+      "Position error :math:`c(q) - \\bar{c}` of the center of mass.",
+      bp::init<const ConfigSpace &, const context::Vector3s &,
+               bp::optional<CachePtr>>(("self"_a, "space", "target", "cache")))
+      .def(bp::init<const PhaseSpace &, const context::Vector3s &,
+                    bp::optional<CachePtr>>(
+          ("self"_a, "space", "target", "cache")))
+      .def_readwrite("target", &CenterOfMass::target_);
 }
 
 } // namespace python
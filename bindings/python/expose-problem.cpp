@@ -24,7 +24,12 @@ void exposeProblem() {
       .add_property("nx", &Problem::nx, "Get the problem tangent space dim.")
       .add_property("ndx", &Problem::ndx, "Get the problem tangent space dim.")
       .def("add_constraint", &Problem::addConstraint<const Constraint &>,
-           ("self"_a, "cstr"), "Add a constraint to the problem.");
+           ("self"_a, "cstr"), "Add a constraint to the problem.")
+      .def("add_cache", &Problem::addCache, ("self"_a, "cache"),
+           "Register a cache shared by the functions of the problem, which is "
+           "invalidated whenever the problem is evaluated at a new point.")
+      .add_property("has_caches", &Problem::hasCaches,
+                    "Whether caches were registered with the problem.");
 }
 
 } // namespace python
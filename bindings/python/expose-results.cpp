@@ -1,4 +1,5 @@
 #include "proxsuite-nlp/python/fwd.hpp"
+#include "proxsuite-nlp/python/views.hpp"
 #include "proxsuite-nlp/results.hpp"
 
 namespace proxsuite {
@@ -11,23 +12,27 @@ void exposeResults() {
   bp::enum_<ConvergenceFlag>("ConvergenceFlag", "Convergence flag enum.")
       .value("uninit", ConvergenceFlag::UNINIT)
       .value("success", ConvergenceFlag::SUCCESS)
-      .value("max_iters_reached", ConvergenceFlag::MAX_ITERS_REACHED);
+      .value("max_iters_reached", ConvergenceFlag::MAX_ITERS_REACHED)
+      .value("trust_region_failure", ConvergenceFlag::TRUST_REGION_FAILURE);
 
   bp::class_<Results>("Results", "Results holder struct.",
                       bp::init<context::Problem &>(bp::args("self", "problem")))
       .def_readonly("converged", &Results::converged)
       .def_readonly("merit", &Results::merit, "Merit function value.")
       .def_readonly("value", &Results::value)
-      .def_readonly("xopt", &Results::x_opt)
-      .def_readonly("data_lamsopt", &Results::data_lams_opt)
+      .add_property("xopt", make_view_getter(&Results::x_opt))
+      .add_property("data_lamsopt", make_view_getter(&Results::data_lams_opt))
       .def_readonly("lamsopt", &Results::lams_opt)
       .def_readonly("activeset", &Results::active_set)
       .def_readonly("num_iters", &Results::num_iters)
+      .def_readonly("al_iters", &Results::al_iters,
+                    "Number of outer (augmented Lagrangian) iterations.")
       .def_readonly("mu", &Results::mu)
       .def_readonly("rho", &Results::rho)
       .def_readonly("dual_infeas", &Results::dual_infeas)
       .def_readonly("prim_infeas", &Results::prim_infeas)
-      .def_readonly("constraint_errs", &Results::constraint_violations,
+      .add_property("constraint_errs",
+                    make_view_getter(&Results::constraint_violations),
                     "Constraint violations.")
       .def(bp::self_ns::str(bp::self));
 }
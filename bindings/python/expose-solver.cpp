@@ -1,4 +1,5 @@
 #include "proxsuite-nlp/python/fwd.hpp"
+#include "proxsuite-nlp/python/gil.hpp"
 #include "proxsuite-nlp/prox-solver.hpp"
 #include <eigenpy/std-unique-ptr.hpp>
 #include <eigenpy/deprecation-policy.hpp>
@@ -7,14 +8,37 @@ namespace proxsuite {
 namespace nlp {
 namespace python {
 
+using context::ConstVectorRef;
+using context::VectorRef;
+using ProxNLPSolver = context::ProxNLPSolverTpl;
+
+// The solver runs with the GIL released, so that other Python threads (e.g.
+// other solvers) run concurrently. Python-defined functions and callbacks
+// re-acquire it in their trampolines.
+
+void setupNoGIL(ProxNLPSolver &solver) {
+  ScopedReleaseGIL nogil;
+  solver.setup();
+}
+
+ConvergenceFlag solveNoGIL(ProxNLPSolver &solver, const ConstVectorRef &x0,
+                           const ConstVectorRef &lams0) {
+  ScopedReleaseGIL nogil;
+  return solver.solve(x0, lams0);
+}
+
+ConvergenceFlag solveListNoGIL(ProxNLPSolver &solver,
+                               const ConstVectorRef &x0,
+                               const std::vector<VectorRef> &lams0) {
+  ScopedReleaseGIL nogil;
+  return solver.solve(x0, lams0);
+}
+
 void exposeSolver() {
   using context::Manifold;
   using context::Scalar;
-  using ProxNLPSolver = context::ProxNLPSolverTpl;
   using context::BCLParams;
-  using context::ConstVectorRef;
   using context::Problem;
-  using context::VectorRef;
   using eigenpy::deprecated_member;
   using eigenpy::DeprecationType;
   using eigenpy::ReturnInternalStdUniquePtr;
@@ -27,8 +51,9 @@ void exposeSolver() {
 
   bp::enum_<LinesearchStrategy>(
       "LinesearchStrategy",
-      "Linesearch strategy. Only Armijo linesearch is implemented for now.")
-      .value("ARMIJO", LinesearchStrategy::ARMIJO);
+      "Linesearch strategy: backtracking Armijo, or strong Wolfe conditions.")
+      .value("ARMIJO", LinesearchStrategy::ARMIJO)
+      .value("WOLFE", LinesearchStrategy::WOLFE);
 
   bp::enum_<HessianApprox>("HessianApprox",
                            "Type of approximation of the Lagrangian Hessian.")
@@ -49,6 +74,15 @@ void exposeSolver() {
       .value("QUADRATIC", LSInterpolation::QUADRATIC)
       .value("CUBIC", LSInterpolation::CUBIC);
 
+  bp::enum_<LSNonmonotone>(
+      "LSNonmonotone",
+      "Nonmonotone acceptance mode of the Armijo linesearch: reference value "
+      "taken as the current merit value, the maximum over a window of past "
+      "merit values, or their weighted average.")
+      .value("NONE", LSNonmonotone::NONE)
+      .value("MAX", LSNonmonotone::MAX)
+      .value("AVERAGE", LSNonmonotone::AVERAGE);
+
   bp::enum_<LDLTChoice>("LDLTChoice", "Choice of LDLT solver.")
       .value("LDLT_DENSE", LDLTChoice::DENSE)
       .value("LDLT_BUNCHKAUFMAN", LDLTChoice::BUNCHKAUFMAN)
@@ -65,6 +99,11 @@ void exposeSolver() {
   bp::class_<ArmijoLinesearch<Scalar>, bp::bases<Linesearch>>(
       "ArmijoLinesearch", bp::no_init)
       .def(bp::init<const LinesearchOptions &>(("self"_a, "options")));
+  bp::class_<WolfeLinesearch<Scalar>, bp::bases<Linesearch>>(
+      "WolfeLinesearch", bp::no_init)
+      .def(bp::init<const LinesearchOptions &>(("self"_a, "options")))
+      .def("numEvals", &WolfeLinesearch<Scalar>::numEvals,
+           "Number of function evaluations of the last run.");
   bp::class_<LinesearchOptions>("LinesearchOptions", "Linesearch options.",
                                 bp::init<>(("self"_a), "Default constructor."))
       .def_readwrite("armijo_c1", &LinesearchOptions::armijo_c1)
@@ -82,14 +121,21 @@ void exposeSolver() {
                      "Minimum step contraction.")
       .def_readwrite("contraction_max", &LinesearchOptions::contraction_max,
                      "Maximum step contraction.")
+      .def_readwrite("parallel_trials", &LinesearchOptions::parallel_trials,
+                     "Number of step sizes evaluated per round by the Armijo "
+                     "linesearch, concurrently if all the problem functions "
+                     "are thread_safe (1 for the sequential linesearch).")
+      .def_readwrite("nonmonotone", &LinesearchOptions::nonmonotone,
+                     "Nonmonotone acceptance mode.")
+      .def_readwrite("nonmonotone_window",
+                     &LinesearchOptions::nonmonotone_window,
+                     "Number of past merit values for the MAX mode.")
+      .def_readwrite("nonmonotone_eta", &LinesearchOptions::nonmonotone_eta,
+                     "Averaging weight for the AVERAGE mode.")
       .def(bp::self_ns::str(bp::self));
 
   using context::Results;
   using context::Workspace;
-  using solve_std_vec_ins_t = ConvergenceFlag (ProxNLPSolver::*)(
-      const ConstVectorRef &, const std::vector<VectorRef> &);
-  using solve_eig_vec_ins_t = ConvergenceFlag (ProxNLPSolver::*)(
-      const ConstVectorRef &, const ConstVectorRef &);
 
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
@@ -124,7 +170,7 @@ void exposeSolver() {
                      "Solver verbose setting.")
       .def_readwrite("ldlt_choice", &ProxNLPSolver::ldlt_choice_,
                      "Use the BlockLDLT solver.")
-      .def("setup", &ProxNLPSolver::setup, ("self"_a),
+      .def("setup", &setupNoGIL, ("self"_a),
            "Initialize the solver workspace and results.")
       .def("getResults", &ProxNLPSolver::getResults, ("self"_a),
            deprecated_member<DeprecationType::DEPRECATION,
@@ -140,12 +186,12 @@ void exposeSolver() {
                                                  ReturnInternalStdUniquePtr{}))
       .add_property("results", bp::make_getter(&ProxNLPSolver::results_,
                                                ReturnInternalStdUniquePtr{}))
-      .def<solve_std_vec_ins_t>(
-          "solve", &ProxNLPSolver::solve, ("self"_a, "x0", "lams0"),
-          "Run the solver (multiplier guesses given as a list).")
-      .def<solve_eig_vec_ins_t>(
-          "solve", &ProxNLPSolver::solve,
-          ("self"_a, "x0", "lams0"_a = context::VectorXs(0)), "Run the solver.")
+      .def("solve", &solveListNoGIL, ("self"_a, "x0", "lams0"),
+           "Run the solver (multiplier guesses given as a list). The GIL is "
+           "released while the solver runs.")
+      .def("solve", &solveNoGIL,
+           ("self"_a, "x0", "lams0"_a = context::VectorXs(0)),
+           "Run the solver. The GIL is released while the solver runs.")
       .def("setPenalty", &ProxNLPSolver::setPenalty, ("self"_a, "mu"),
            "Set the augmented Lagrangian penalty parameter.")
       .def("setDualPenalty", &ProxNLPSolver::setDualPenalty,
@@ -173,6 +219,10 @@ void exposeSolver() {
                      "Target tolerance.")
       .def_readwrite("ls_options", &ProxNLPSolver::ls_options,
                      "Linesearch options.")
+      .def_readwrite("globalization", &ProxNLPSolver::globalization,
+                     "Globalization strategy: linesearch or trust region.")
+      .def_readwrite("tr_params", &ProxNLPSolver::tr_params,
+                     "Trust-region parameters.")
       .def_readwrite("mul_update_mode", &ProxNLPSolver::mul_update_mode,
                      "Type of multiplier update.")
       .def_readwrite("kkt_system", &ProxNLPSolver::kkt_system_,
@@ -208,6 +258,29 @@ void exposeSolver() {
                      "Multiplier update factor.")
       .def_readwrite("rho_factor", &BCLParams::rho_update_factor,
                      "Proximal penalty update factor.");
+
+  bp::enum_<GlobalizationStrategy>("GlobalizationStrategy",
+                                   "Globalization of the inner iterations.")
+      .value("LINESEARCH", GlobalizationStrategy::LINESEARCH)
+      .value("TRUST_REGION", GlobalizationStrategy::TRUST_REGION);
+
+  using TrustRegionParams = TrustRegionParamsTpl<Scalar>;
+  bp::class_<TrustRegionParams>("TrustRegionParams",
+                                "Parameters of the dogleg trust-region "
+                                "globalization.",
+                                bp::init<>(("self"_a)))
+      .def_readwrite("radius_init", &TrustRegionParams::radius_init)
+      .def_readwrite("radius_min", &TrustRegionParams::radius_min)
+      .def_readwrite("radius_max", &TrustRegionParams::radius_max)
+      .def_readwrite("eta_accept", &TrustRegionParams::eta_accept,
+                     "Minimum ratio of actual to predicted decrease.")
+      .def_readwrite("eta_shrink", &TrustRegionParams::eta_shrink,
+                     "Ratio below which the radius is shrunk.")
+      .def_readwrite("eta_expand", &TrustRegionParams::eta_expand,
+                     "Ratio above which the radius is expanded.")
+      .def_readwrite("shrink_factor", &TrustRegionParams::shrink_factor)
+      .def_readwrite("expand_factor", &TrustRegionParams::expand_factor)
+      .def_readwrite("max_trials", &TrustRegionParams::max_trials);
 }
 } // namespace python
 } // namespace nlp
@@ -1,4 +1,5 @@
 #include "proxsuite-nlp/python/fwd.hpp"
+#include "proxsuite-nlp/python/views.hpp"
 
 #include "proxsuite-nlp/workspace.hpp"
 
@@ -11,11 +12,14 @@ void exposeWorkspace() {
   bp::class_<Workspace, boost::noncopyable>(
       "Workspace", "ProxNLPSolverTpl workspace.",
       bp::init<const context::Problem &>(bp::args("self", "problem")))
-      .def_readonly("kkt_matrix", &Workspace::kkt_matrix, "KKT matrix buffer.")
-      .def_readonly("kkt_rhs", &Workspace::kkt_rhs,
+      .add_property("kkt_matrix", make_view_getter(&Workspace::kkt_matrix),
+                    "KKT matrix buffer.")
+      .add_property("kkt_rhs", make_view_getter(&Workspace::kkt_rhs),
                     "KKT system right-hand side buffer.")
-      .def_readonly("kkt_err", &Workspace::kkt_err, "KKT system error.")
-      .def_readonly("pd_step", &Workspace::pd_step, "The primal-dual step.")
+      .add_property("kkt_err", make_view_getter(&Workspace::kkt_err),
+                    "KKT system error.")
+      .add_property("pd_step", make_view_getter(&Workspace::pd_step),
+                    "The primal-dual step.")
       .add_property(
           "prim_step",
           bp::make_getter(&Workspace::prim_step,
@@ -25,36 +29,47 @@ void exposeWorkspace() {
           bp::make_getter(&Workspace::dual_step,
                           bp::return_value_policy<bp::return_by_value>()))
       .def_readonly("objective_value", &Workspace::objective_value)
-      .def_readonly("objective_gradient", &Workspace::objective_gradient)
-      .def_readonly("objective_hessian", &Workspace::objective_hessian)
-      .def_readonly("merit_gradient", &Workspace::merit_gradient)
-      .def_readonly("merit_dual_gradient", &Workspace::merit_dual_gradient)
-      .def_readonly("data_cstr_values", &Workspace::data_cstr_values)
+      .add_property("objective_gradient",
+                    make_view_getter(&Workspace::objective_gradient))
+      .add_property("objective_hessian",
+                    make_view_getter(&Workspace::objective_hessian))
+      .add_property("merit_gradient",
+                    make_view_getter(&Workspace::merit_gradient))
+      .add_property("merit_dual_gradient",
+                    make_view_getter(&Workspace::merit_dual_gradient))
+      .add_property("data_cstr_values",
+                    make_view_getter(&Workspace::data_cstr_values))
       .def_readonly("cstr_values", &Workspace::cstr_values,
                     "Vector constraint residuals.")
-      .def_readonly("data_shift_cstr_values",
-                    &Workspace::data_shift_cstr_values,
+      .add_property("data_shift_cstr_values",
+                    make_view_getter(&Workspace::data_shift_cstr_values),
                     "Shifted constraint values.")
-      .def_readonly("dual_residuals", &Workspace::dual_residual,
+      .add_property("dual_residuals",
+                    make_view_getter(&Workspace::dual_residual),
                     "Dual vector residual.")
-      .def_readonly("data_jacobians", &Workspace::data_jacobians,
+      .add_property("data_jacobians",
+                    make_view_getter(&Workspace::data_jacobians),
                     "Constraint Jacobians.")
-      .def_readonly("data_hessians", &Workspace::data_hessians,
+      .add_property("data_hessians",
+                    make_view_getter(&Workspace::data_hessians),
                     "Constraint vector-Hessian product matrices.")
       .def_readonly("cstr_jacobians", &Workspace::cstr_jacobians,
                     "Block jacobians.")
-      .def_readonly("data_jacobians_proj", &Workspace::data_jacobians_proj,
+      .add_property("data_jacobians_proj",
+                    make_view_getter(&Workspace::data_jacobians_proj),
                     "Projected constraint Jacobians.")
       .def_readonly("cstr_jacobians_proj", &Workspace::cstr_jacobians_proj,
                     "Projected constraint Jacobians.")
       .def_readonly("lams_plus", &Workspace::lams_plus,
                     "First-order multiplier estimates.")
-      .def_readonly("data_lams_plus", &Workspace::data_lams_plus,
+      .add_property("data_lams_plus",
+                    make_view_getter(&Workspace::data_lams_plus),
                     "First-order multiplier estimates.")
       .def_readonly("lams_plus_reproj", &Workspace::lams_plus_reproj,
                     "Product of projection Jacobian and first-order multiplier "
                     "estimates.")
-      .def_readonly("data_lams_pdal", &Workspace::data_lams_pdal,
+      .add_property("data_lams_pdal",
+                    make_view_getter(&Workspace::data_lams_pdal),
                     "Primal-dual multiplier estimates.")
       .def_readonly("lams_pdal", &Workspace::lams_pdal,
                     "Primal-dual multiplier estimates.")
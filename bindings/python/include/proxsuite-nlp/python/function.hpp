@@ -1,4 +1,5 @@
 #include "proxsuite-nlp/python/fwd.hpp"
+#include "proxsuite-nlp/python/gil.hpp"
 
 #include "proxsuite-nlp/function-base.hpp"
 
@@ -13,47 +14,83 @@ public:
   using context::Function::BaseFunctionTpl;
 
   VectorXs operator()(const ConstVectorRef &x) const {
+    ScopedAcquireGIL gil;
     bp::override f = get_override("__call__");
     return f(x);
   }
 };
 
-struct C1FunctionWrap : context::C1Function, bp::wrapper<context::C1Function> {
+/// @brief Trampoline for the differentiable functions defined in Python.
+/// @details The Python class either overrides `__call__()` and
+/// `computeJacobian()` (and `vectorHessianProduct()`), or implements the
+/// combined protocol `evaluate_all(x, out_value, out_jac, lam, out_vhp)`.
+/// The latter writes, in a single call, into the preallocated outputs which
+/// are not None (the vector-Hessian product is requested along with its
+/// multiplier `lam`). If both are defined, evaluate_all() is used when the
+/// solver requests the value and the Jacobian together.
+template <class Base> struct DifferentiableFunctionWrapTpl : Base,
+                                                             bp::wrapper<Base> {
   PROXSUITE_NLP_DYNAMIC_TYPEDEFS(context::Scalar);
 
-  using context::C1Function::C1FunctionTpl;
+  using Base::Base;
 
   VectorXs operator()(const ConstVectorRef &x) const {
-    bp::override f = get_override("__call__");
-    return f(x);
+    ScopedAcquireGIL gil;
+    if (bp::override f = this->get_override("__call__"))
+      return f(x);
+    VectorXs out(this->nr());
+    evaluateAll(x, VectorRef(out), bp::object(), bp::object(), bp::object());
+    return out;
   }
 
   void computeJacobian(const ConstVectorRef &x, MatrixRef Jout) const {
+    ScopedAcquireGIL gil;
     Jout.resize(this->nr(), this->ndx());
-    get_override("computeJacobian")(x, Jout);
+    if (bp::override f = this->get_override("computeJacobian"))
+      f(x, Jout);
+    else
+      evaluateAll(x, bp::object(), Jout, bp::object(), bp::object());
   }
-};
-
-struct C2FunctionWrap : context::C2Function, bp::wrapper<context::C2Function> {
-  PROXSUITE_NLP_DYNAMIC_TYPEDEFS(context::Scalar);
 
-  using context::C2Function::C2FunctionTpl;
-
-  VectorXs operator()(const ConstVectorRef &x) const {
-    bp::override f = get_override("__call__");
-    return f(x);
+  void evaluateWithJacobian(const ConstVectorRef &x, VectorRef out,
+                            MatrixRef Jout) const {
+    ScopedAcquireGIL gil;
+    if (bp::override f = this->get_override("evaluate_all")) {
+      f(x, out, Jout, bp::object(), bp::object());
+    } else {
+      out = (*this)(x);
+      computeJacobian(x, Jout);
+    }
   }
 
-  void computeJacobian(const ConstVectorRef &x, MatrixRef Jout) const {
-    Jout.resize(this->nr(), this->ndx());
-    get_override("computeJacobian")(x, Jout);
+protected:
+  /// Call the `evaluate_all()` protocol, with the GIL held.
+  template <typename... Args>
+  void evaluateAll(const ConstVectorRef &x, const Args &...outputs) const {
+    bp::override f = this->get_override("evaluate_all");
+    if (!f)
+      PROXSUITE_NLP_RUNTIME_ERROR(
+          "Python function classes should override either __call__() and "
+          "computeJacobian(), or evaluate_all().");
+    f(x, outputs...);
   }
+};
+
+using C1FunctionWrap = DifferentiableFunctionWrapTpl<context::C1Function>;
+
+struct C2FunctionWrap : DifferentiableFunctionWrapTpl<context::C2Function> {
+  PROXSUITE_NLP_DYNAMIC_TYPEDEFS(context::Scalar);
+
+  using DifferentiableFunctionWrapTpl::DifferentiableFunctionWrapTpl;
 
   void vectorHessianProduct(const ConstVectorRef &x, const ConstVectorRef &v,
                             MatrixRef Hout) const {
+    ScopedAcquireGIL gil;
     Hout.resize(this->ndx(), this->ndx());
     if (bp::override f = this->get_override("vectorHessianProduct")) {
       f(x, v, Hout);
+    } else if (bp::override all = this->get_override("evaluate_all")) {
+      all(x, bp::object(), bp::object(), v, Hout);
     } else {
       context::C2Function::vectorHessianProduct(x, v, Hout);
     }
@@ -0,0 +1,40 @@
+/// @file gil.hpp
+/// @copyright Copyright (C) 2026 LAAS-CNRS, INRIA
+/// @brief  Scoped management of the Python global interpreter lock (GIL).
+#pragma once
+
+#include <Python.h>
+
+namespace proxsuite {
+namespace nlp {
+namespace python {
+
+/// @brief Release the GIL for the lifetime of the object, e.g. while the
+/// solver runs, so that other Python threads can proceed.
+struct ScopedReleaseGIL {
+  ScopedReleaseGIL() : state_(PyEval_SaveThread()) {}
+  ~ScopedReleaseGIL() { PyEval_RestoreThread(state_); }
+  ScopedReleaseGIL(const ScopedReleaseGIL &) = delete;
+  ScopedReleaseGIL &operator=(const ScopedReleaseGIL &) = delete;
+
+private:
+  PyThreadState *state_;
+};
+
+/// @brief Acquire the GIL for the lifetime of the object.
+/// @details This is required in every trampoline calling into Python, since
+/// the solver releases the GIL and may call them from worker threads. It is a
+/// no-op if the calling thread already holds the GIL.
+struct ScopedAcquireGIL {
+  ScopedAcquireGIL() : state_(PyGILState_Ensure()) {}
+  ~ScopedAcquireGIL() { PyGILState_Release(state_); }
+  ScopedAcquireGIL(const ScopedAcquireGIL &) = delete;
+  ScopedAcquireGIL &operator=(const ScopedAcquireGIL &) = delete;
+
+private:
+  PyGILState_STATE state_;
+};
+
+} // namespace python
+} // namespace nlp
+} // namespace proxsuite
@@ -1,5 +1,6 @@
 #pragma once
 #include "proxsuite-nlp/python/fwd.hpp"
+#include "proxsuite-nlp/python/gil.hpp"
 #include "proxsuite-nlp/third-party/polymorphic_cxx14.hpp"
 #include "proxsuite-nlp/macros.hpp"
 
@@ -44,6 +45,7 @@ template <class Poly> struct PolymorphicVisitor;
 ///   };
 ///   struct PyX final : X, proxsuite::nlp::python::PolymorphicWrapper<PyX, X> {
 ///     std::string name() const override {
+///       proxsuite::nlp::python::ScopedAcquireGIL gil;
 ///       if (boost::python::override f = get_override("name")) {
 ///         return f();
 ///       }
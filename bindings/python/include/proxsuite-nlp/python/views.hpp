@@ -0,0 +1,33 @@
+/// @file views.hpp
+/// @copyright Copyright (C) 2026 LAAS-CNRS, INRIA
+/// @brief  Expose Eigen data members as NumPy views, without copies.
+#pragma once
+
+#include "proxsuite-nlp/python/fwd.hpp"
+
+#include <boost/mpl/vector.hpp>
+
+namespace proxsuite {
+namespace nlp {
+namespace python {
+
+/// @brief Getter returning a NumPy array which aliases the Eigen data member
+/// @p member of @p Class, instead of a converted copy.
+/// @details The array is read-only (its `WRITEABLE` flag is unset), since the
+/// buffers belong to the solver. It keeps its owner alive, but is invalidated
+/// if the buffer is reallocated, e.g. when the solver is set up again: copy it
+/// to keep the values.
+template <class Class, typename MatrixType>
+bp::object make_view_getter(MatrixType Class::*member) {
+  using ViewType = Eigen::Ref<const MatrixType>;
+  auto getter = [member](const Class &self) -> ViewType {
+    return self.*member;
+  };
+  return bp::make_function(getter,
+                           bp::with_custodian_and_ward_postcall<0, 1>(),
+                           boost::mpl::vector<ViewType, const Class &>());
+}
+
+} // namespace python
+} // namespace nlp
+} // namespace proxsuite
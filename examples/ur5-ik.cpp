@@ -1,11 +1,11 @@
 #include <pinocchio/algorithm/kinematics.hpp>
 #include <pinocchio/algorithm/frames.hpp>
-#include <pinocchio/algorithm/frames-derivatives.hpp>
 #include <pinocchio/multibody/model.hpp>
 #include <pinocchio/multibody/data.hpp>
 #include <pinocchio/parsers/urdf.hpp>
 
 #include <proxsuite-nlp/modelling/spaces/multibody.hpp>
+#include <proxsuite-nlp/modelling/residuals/multibody-residuals.hpp>
 #include <proxsuite-nlp/modelling/costs/quadratic-residual.hpp>
 #include <proxsuite-nlp/modelling/costs/squared-distance.hpp>
 #include <proxsuite-nlp/cost-sum.hpp>
@@ -36,38 +36,6 @@ Model loadModel() {
   return out;
 }
 
-struct FramePosition : C2FunctionTpl<Scalar> {
-  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
-  using Base = C2FunctionTpl<Scalar>;
-
-  Space space_;
-  mutable Data data_;
-  pin::FrameIndex fid_;
-  Vector3s ref_;
-  mutable Matrix6Xs fJf_;
-
-  FramePosition(const Space &space, pin::FrameIndex fid, const Vector3s &ref)
-      : Base(space, 3), space_(space), data_(space_.getModel()), fid_(fid),
-        ref_(ref), fJf_(6, getModel().nv) {
-    fJf_.setZero();
-  }
-
-  Model const &getModel() const { return space_.getModel(); }
-
-  VectorXs operator()(const ConstVectorRef &q) const override {
-    pin::forwardKinematics(getModel(), data_, q);
-    pin::updateFramePlacement(getModel(), data_, fid_);
-    return data_.oMf[fid_].translation() - ref_;
-  }
-
-  void computeJacobian(const ConstVectorRef & /*q*/,
-                       MatrixRef Jout) const override {
-    pin::computeJointJacobians(getModel(), data_);
-    pin::getFrameJacobian(getModel(), data_, fid_, pin::LOCAL, fJf_);
-    Jout.leftCols(getModel().nv) = data_.oMf[fid_].rotation() * fJf_.topRows(3);
-  }
-};
-
 int main() {
 
   const std::string ee_link_name = "tool0";
@@ -76,7 +44,10 @@ int main() {
   pin::FrameIndex fid = model.getFrameId(ee_link_name);
 
   Vector3s ref(1.0, 0., 0.2);
-  auto fn = std::make_shared<FramePosition>(space, fid, ref);
+  // kinematics shared by the functions of the problem
+  auto cache = std::make_shared<MultibodyDataCacheTpl<Scalar>>(model);
+  auto fn = std::make_shared<FrameTranslationResidualTpl<Scalar>>(
+      space, fid, ref, cache);
 
   auto q0 = pin::neutral(model);
   MatrixXs w1(3, 3);
@@ -94,6 +65,7 @@ int main() {
   cost->addComponent(cost2);
 
   Problem problem(space, cost);
+  problem.addCache(cache);
 
   constexpr bool has_joint_lims = true;
   if (has_joint_lims) {
@@ -5,6 +5,8 @@
 #include "proxsuite-nlp/function-base.hpp"
 #include "proxsuite-nlp/third-party/polymorphic_cxx14.hpp"
 
+#include <typeinfo>
+
 namespace proxsuite {
 namespace nlp {
 
@@ -77,6 +79,44 @@ public:
   virtual void computeActiveSet(const ConstVectorRef &z,
                                 Eigen::Ref<ActiveType> out) const = 0;
 
+  /// @brief Evaluate, in a single call, the operators needed by the solver at
+  /// the shifted constraint value @p z and its primal-dual counterpart
+  /// @p zpdal.
+  /// @details The default implementation calls normalConeProjection(),
+  /// applyProjectionJacobian() and computeActiveSet() on both inputs.
+  ///
+  /// @param[in]  z                 Shifted constraint value
+  /// @param[in]  zpdal             Primal-dual shifted constraint value
+  /// @param[out] zncp              Normal cone projection of @p z
+  /// @param[out] zncp_pdal         Normal cone projection of @p zpdal
+  /// @param[out] zncp_reproj       Projection Jacobian at @p z applied to
+  /// @p zncp
+  /// @param[out] zncp_pdal_reproj  Projection Jacobian at @p zpdal applied to
+  /// @p zncp_pdal
+  /// @param[out] active            Active set at @p z
+  /// @param[out] active_pdal       Active set at @p zpdal
+  virtual void computeAll(const ConstVectorRef &z, const ConstVectorRef &zpdal,
+                          VectorRef zncp, VectorRef zncp_pdal,
+                          VectorRef zncp_reproj, VectorRef zncp_pdal_reproj,
+                          Eigen::Ref<ActiveType> active,
+                          Eigen::Ref<ActiveType> active_pdal) const;
+
+  /// @brief Whether the projection Jacobians are diagonal, the normal cone
+  /// projection Jacobian being the indicator of the active set.
+  /// @details In that case, the solver applies the active set as a row mask
+  /// on the constraint Jacobian instead of calling
+  /// applyNormalConeProjectionJacobian(). Defaults to false.
+  virtual bool hasDiagonalProjectionJacobian() const { return false; }
+
+  /// @brief Try to extend this set with the set @p other, acting on the
+  /// coordinates which follow this one's.
+  /// @details If successful, a single call of the projection operators on the
+  /// concatenated input replaces one call per set. This is used by the solver
+  /// to batch contiguous constraint blocks of the same type.
+  /// @returns Whether @p other was merged into this set. The default
+  /// implementation returns false.
+  virtual bool tryMerge(const ConstraintSetTpl & /*other*/) { return false; }
+
   virtual ~ConstraintSetTpl() = default;
 
   bool operator==(const ConstraintSetTpl<Scalar> &rhs) { return this == &rhs; }
@@ -37,5 +37,20 @@ void ConstraintSetTpl<Scalar>::applyNormalConeProjectionJacobian(
   }
 }
 
+template <typename Scalar>
+void ConstraintSetTpl<Scalar>::computeAll(
+    const ConstVectorRef &z, const ConstVectorRef &zpdal, VectorRef zncp,
+    VectorRef zncp_pdal, VectorRef zncp_reproj, VectorRef zncp_pdal_reproj,
+    Eigen::Ref<ActiveType> active, Eigen::Ref<ActiveType> active_pdal) const {
+  normalConeProjection(z, zncp);
+  normalConeProjection(zpdal, zncp_pdal);
+  zncp_reproj = zncp;
+  zncp_pdal_reproj = zncp_pdal;
+  applyProjectionJacobian(z, zncp_reproj);
+  applyProjectionJacobian(zpdal, zncp_pdal_reproj);
+  computeActiveSet(z, active);
+  computeActiveSet(zpdal, active_pdal);
+}
+
 } // namespace nlp
 } // namespace proxsuite
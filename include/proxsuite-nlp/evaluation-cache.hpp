@@ -0,0 +1,21 @@
+/// @file evaluation-cache.hpp
+/// @copyright Copyright (C) 2026 LAAS-CNRS, INRIA
+/// @brief  Data shared by the functions of a problem at an evaluation point.
+#pragma once
+
+namespace proxsuite {
+namespace nlp {
+
+/// @brief  Base class for intermediate quantities shared by several functions
+/// of a problem at the same point, e.g. the kinematics of a multibody system
+/// (MultibodyDataCacheTpl).
+/// @details Caches are registered with ProblemTpl::addCache(), which
+/// invalidates them whenever the problem is evaluated at a new point.
+struct EvaluationCacheBase {
+  virtual ~EvaluationCacheBase() = default;
+  /// Mark the cached quantities as outdated.
+  virtual void invalidate() = 0;
+};
+
+} // namespace nlp
+} // namespace proxsuite
@@ -15,6 +15,7 @@ protected:
   int nx_;
   int ndx_;
   int nr_;
+  bool thread_safe_ = false;
 
 public:
   using Scalar = _Scalar;
@@ -37,6 +38,15 @@ public:
   int ndx() const { return ndx_; }
   /// Get function codimension.
   int nr() const { return nr_; }
+
+  /// @brief Whether the function may be evaluated from several threads at
+  /// once, e.g. because it holds no mutable buffer. Defaults to false.
+  /// @details The solver only evaluates the linesearch trials concurrently
+  /// (see LinesearchOptions::parallel_trials) if all the functions of the
+  /// problem are thread-safe.
+  virtual bool isThreadSafe() const { return thread_safe_; }
+  /// Declare whether the function is safe to evaluate concurrently.
+  void setThreadSafe(const bool value) { thread_safe_ = value; }
 };
 
 /** @brief  Differentiable function, with method for the Jacobian.
@@ -51,10 +61,39 @@ public:
   // We can't use using Base::Base because of MSVC explicit template
   // instantiation
   C1FunctionTpl(const int nx, const int ndx, const int nr)
-      : Base(nx, ndx, nr) {}
+      : Base(nx, ndx, nr), jac_col_start_(0), jac_col_size_(ndx) {}
   C1FunctionTpl(const ManifoldAbstractTpl<Scalar> &manifold, const int nr)
       : C1FunctionTpl(manifold.nx(), manifold.ndx(), nr) {}
 
+  /**
+   * @brief Declare the Jacobian to be zero outside of the column block
+   * \f$[\mathrm{start}, \mathrm{start} + \mathrm{size})\f$.
+   *
+   * @details The solver then only reads (and multiplies by) these columns of
+   * the Jacobian. Outside of the block, computeJacobian() must output zeros;
+   * the solver workspace is zero-initialized so these entries need not be
+   * rewritten at every call.
+   *
+   * The solver workspace batches the constraints by column block when it is
+   * allocated: call this before ProxNLPSolverTpl::setup(), or call setup()
+   * again. ProxNLPSolverTpl::solve() throws if the blocks changed since.
+   */
+  void setJacobianColumns(const int start, const int size) {
+    if ((start < 0) || (size < 0) || (start + size > this->ndx()))
+      PROXSUITE_NLP_RUNTIME_ERROR(
+          fmt::format("Invalid Jacobian column block [{:d}, {:d}) for input "
+                      "tangent dimension {:d}.",
+                      start, start + size, this->ndx()));
+    jac_col_start_ = start;
+    jac_col_size_ = size;
+  }
+  /// First nonzero column of the Jacobian.
+  int jacobianColStart() const { return jac_col_start_; }
+  /// Number of (possibly) nonzero columns of the Jacobian.
+  int jacobianColSize() const { return jac_col_size_; }
+  /// Whether the Jacobian was declared to have structurally zero columns.
+  bool hasSparseJacobian() const { return jac_col_size_ < this->ndx(); }
+
   /// @brief      Jacobian matrix of the constraint function.
   virtual void computeJacobian(const ConstVectorRef &x,
                                MatrixRef Jout) const = 0;
@@ -68,6 +107,23 @@ public:
     computeJacobian(x, Jout);
     return Jout;
   }
+
+  /**
+   * @brief Evaluate the function and its Jacobian in a single call.
+   *
+   * @details The default implementation calls operator() and
+   * computeJacobian(). Override it to share computations between the two, or
+   * to call into an interpreter only once.
+   */
+  virtual void evaluateWithJacobian(const ConstVectorRef &x, VectorRef out,
+                                    MatrixRef Jout) const {
+    out = (*this)(x);
+    computeJacobian(x, Jout);
+  }
+
+protected:
+  int jac_col_start_;
+  int jac_col_size_;
 };
 
 /** @brief  Twice-differentiable function, with method Jacobian and
@@ -29,6 +29,9 @@ public:
           "Incompatible dimensions ({:d} and {:d}).", left->nx(), right->nr()));
     }
     assert(left->nx() == right->nr());
+    // the zero columns of the inner Jacobian are zero in the product
+    this->setJacobianColumns(right->jacobianColStart(),
+                             right->jacobianColSize());
   }
 
   VectorXs operator()(const ConstVectorRef &x) const {
@@ -9,6 +9,8 @@
 
 #include <Eigen/QR>
 
+#include <utility>
+
 namespace proxsuite {
 namespace nlp {
 
@@ -54,10 +56,24 @@ public:
 
   ArmijoLinesearch(const typename Base::Options &options) : Base(options) {}
 
-  using fun_t = std::function<Scalar(Scalar)>;
-
-  Scalar run(fun_t phi, const Scalar phi0, const Scalar dphi0,
+  /// @brief Backtracking on the Armijo condition.
+  /// @param phi  Callable `Scalar(Scalar alpha)` evaluating the merit function
+  /// at a step size; it should return a non-finite value if the evaluation
+  /// fails (see Linesearch::isValid()).
+  template <typename Fn>
+  Scalar run(Fn &&phi, const Scalar phi0, const Scalar dphi0,
              Scalar &alpha_try) {
+    return run(std::forward<Fn>(phi), phi0, dphi0, alpha_try, phi0);
+  }
+
+  /// @brief Backtracking on the sufficient decrease condition
+  /// \f$ \phi(\alpha) \leq \phi_\mathrm{ref} + c_1\alpha\phi'(0) \f$.
+  /// @details A reference value @p phi_ref greater than @p phi0 allows
+  /// nonmonotone steps (see NonmonotoneReference); the interpolation still uses
+  /// the value and derivative at zero.
+  template <typename Fn>
+  Scalar run(Fn &&phi, const Scalar phi0, const Scalar dphi0,
+             Scalar &alpha_try, const Scalar phi_ref) {
     const FunctionSample lower_bound(0., phi0, dphi0);
 
     alpha_try = 1.;
@@ -65,17 +81,17 @@ public:
     FunctionSample previous;
 
     // try the full step; if failure encountered, aggressively
-    // backtrack until no exception is raised
+    // backtrack until the evaluation succeeds
     while (true) {
-      try {
-        latest = FunctionSample(alpha_try, phi(alpha_try));
+      const Scalar value = phi(alpha_try);
+      if (Base::isValid(value)) {
+        latest = FunctionSample(alpha_try, value);
+        break;
+      }
+      alpha_try *= 0.5;
+      if (alpha_try <= options_.alpha_min) {
+        alpha_try = options_.alpha_min;
         break;
-      } catch (const std::runtime_error &e) {
-        alpha_try *= 0.5;
-        if (alpha_try <= options_.alpha_min) {
-          alpha_try = options_.alpha_min;
-          break;
-        }
       }
     }
 
@@ -85,7 +101,7 @@ public:
 
     for (std::size_t i = 0; i < options_.max_num_steps; i++) {
 
-      const Scalar dM = latest.phi - phi0;
+      const Scalar dM = latest.phi - phi_ref;
       if (dM <= options_.armijo_c1 * alpha_try * dphi0) {
         break;
       }
@@ -131,12 +147,12 @@ public:
         alpha_try = std::max(alpha_try, options_.alpha_min);
       }
 
-      try {
-        previous = latest;
-        latest = FunctionSample(alpha_try, phi(alpha_try));
-      } catch (const std::runtime_error &e) {
+      previous = latest;
+      const Scalar value = phi(alpha_try);
+      if (!Base::isValid(value)) {
         continue;
       }
+      latest = FunctionSample(alpha_try, value);
 
       if (alpha_try <= options_.alpha_min) {
         break;
@@ -146,6 +162,61 @@ public:
     return latest.phi;
   }
 
+  /// @brief Backtracking over rounds of Options::parallel_trials step sizes
+  /// \f$\alpha_0 c^j\f$, evaluated in a single call of @p phis.
+  /// @details The largest step size of a round satisfying the Armijo condition
+  /// is accepted; otherwise, the next round continues the geometric ladder.
+  /// @param phis Callable `void(const std::vector<Scalar> &alphas,
+  /// std::vector<Scalar> &values)` evaluating the merit function at several
+  /// step sizes, e.g. concurrently. Failed evaluations should output a
+  /// non-finite value.
+  template <typename BatchFn>
+  Scalar runBatched(BatchFn &&phis, const Scalar phi0, const Scalar dphi0,
+                    Scalar &alpha_try) {
+    return runBatched(std::forward<BatchFn>(phis), phi0, dphi0, alpha_try,
+                      phi0);
+  }
+
+  /// @copybrief runBatched()
+  /// @details Nonmonotone variant, see run().
+  template <typename BatchFn>
+  Scalar runBatched(BatchFn &&phis, const Scalar /*phi0*/,
+                    const Scalar dphi0, Scalar &alpha_try,
+                    const Scalar phi_ref) {
+    const std::size_t m = std::max(options_.parallel_trials, std::size_t(1));
+    const Scalar c = options_.contraction_min;
+    std::vector<Scalar> alphas(m);
+    std::vector<Scalar> values(m);
+    // fallback: smallest step size with a finite merit value
+    FunctionSample fallback;
+    Scalar alpha = 1.;
+    std::size_t num_evals = 0;
+    while (true) {
+      for (std::size_t j = 0; j < m; j++) {
+        alphas[j] = std::max(alpha, options_.alpha_min);
+        alpha *= c;
+      }
+      phis(alphas, values);
+      num_evals += m;
+      for (std::size_t j = 0; j < m; j++) {
+        if (!Base::isValid(values[j]))
+          continue;
+        const Scalar dM = values[j] - phi_ref;
+        if ((std::abs(dphi0) < options_.dphi_thresh) ||
+            (dM <= options_.armijo_c1 * alphas[j] * dphi0)) {
+          alpha_try = alphas[j];
+          return values[j];
+        }
+        fallback = FunctionSample(alphas[j], values[j]);
+      }
+      if ((alphas[m - 1] <= options_.alpha_min) ||
+          (num_evals > options_.max_num_steps))
+        break;
+    }
+    alpha_try = fallback.valid ? fallback.alpha : options_.alpha_min;
+    return fallback.phi;
+  }
+
   /// Propose a new candidate step size through safeguarded interpolation
   Scalar minimize_interpolant(LSInterpolation strat, Scalar min_step_size,
                               Scalar max_step_size) {
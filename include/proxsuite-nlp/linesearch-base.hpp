@@ -4,12 +4,19 @@
 #pragma once
 
 #include <fmt/format.h>
+#include <algorithm>
+#include <cmath>
 #include <ostream>
+#include <vector>
 
 namespace proxsuite {
 namespace nlp {
 enum class LinesearchStrategy { ARMIJO, WOLFE };
 enum class LSInterpolation { BISECTION, QUADRATIC, CUBIC };
+/// Reference value of the sufficient decrease condition: the current merit
+/// value (monotone), the maximum over a window of past merit values
+/// (Grippo-Lampariello-Lucidi) or their weighted average (Zhang-Hager).
+enum class LSNonmonotone { NONE, MAX, AVERAGE };
 
 /// @brief Base linesearch class.
 /// Design pattern inspired by Google Ceres-Solver.
@@ -19,7 +26,9 @@ public:
     Options()
         : armijo_c1(1e-4), wolfe_c2(0.9), dphi_thresh(1e-13), alpha_min(1e-6),
           max_num_steps(20), interp_type(LSInterpolation::CUBIC),
-          contraction_min(0.5), contraction_max(0.8) {}
+          contraction_min(0.5), contraction_max(0.8), parallel_trials(1),
+          nonmonotone(LSNonmonotone::NONE), nonmonotone_window(5),
+          nonmonotone_eta(0.85) {}
     T armijo_c1;
     T wolfe_c2;
     T dphi_thresh;
@@ -28,6 +37,20 @@ public:
     LSInterpolation interp_type;
     T contraction_min;
     T contraction_max;
+    /// Number of step sizes of the backtracking ladder
+    /// \f$\alpha, c\alpha, c^2\alpha, \ldots\f$ (with \f$c\f$ =
+    /// contraction_min) evaluated per round by the Armijo linesearch,
+    /// concurrently if the problem functions are thread-safe (see
+    /// BaseFunctionTpl::isThreadSafe()). Values less than 2 keep the
+    /// sequential linesearch.
+    std::size_t parallel_trials;
+    /// Nonmonotone acceptance mode of the Armijo linesearch.
+    LSNonmonotone nonmonotone;
+    /// Number of past merit values for LSNonmonotone::MAX.
+    std::size_t nonmonotone_window;
+    /// Averaging weight \f$\eta\in[0,1]\f$ for LSNonmonotone::AVERAGE; zero
+    /// recovers the monotone rule.
+    T nonmonotone_eta;
     friend std::ostream &operator<<(std::ostream &oss, const Options &self) {
       oss << "{";
       oss << fmt::format("armijo_c1 = {:.3e}", self.armijo_c1);
@@ -35,6 +58,15 @@ public:
           << fmt::format("contraction_min = {:.3e}", self.contraction_min);
       oss << ", "
           << fmt::format("contraction_max = {:.3e}", self.contraction_max);
+      if (self.parallel_trials > 1)
+        oss << ", "
+            << fmt::format("parallel_trials = {}", self.parallel_trials);
+      if (self.nonmonotone == LSNonmonotone::MAX)
+        oss << ", "
+            << fmt::format("nonmonotone_window = {}", self.nonmonotone_window);
+      else if (self.nonmonotone == LSNonmonotone::AVERAGE)
+        oss << ", "
+            << fmt::format("nonmonotone_eta = {:.3e}", self.nonmonotone_eta);
       oss << "}";
       return oss;
     }
@@ -52,6 +84,11 @@ public:
     FunctionSample(T a, T v, T g) : alpha(a), phi(v), dphi(g), valid(true) {}
   };
 
+  /// Status of an evaluation of the merit function: failed evaluations (e.g.
+  /// outside of the domain of the problem functions) are signalled by a
+  /// non-finite value, rather than by an exception.
+  static bool isValid(const T value) { return std::isfinite(value); }
+
   void setOptions(const Linesearch::Options &options) { options_ = options; }
 
   void reset() {}
@@ -65,6 +102,61 @@ Linesearch<T>::Linesearch(const Linesearch::Options &options)
 
 template <typename T> Linesearch<T>::~Linesearch() = default;
 
+/// @brief History of the merit values accepted by the linesearch, from which
+/// the reference value of the nonmonotone Armijo condition is computed.
+/// @details It should be reset whenever the merit function changes, e.g. when
+/// the augmented Lagrangian parameters are updated.
+template <typename T> class NonmonotoneReference {
+public:
+  using Options = typename Linesearch<T>::Options;
+
+  void reset() {
+    values_.clear();
+    head_ = 0;
+    average_ = 0.;
+    weight_ = 0.;
+  }
+
+  /// Record the merit value at the current iterate.
+  void push(const Options &options, const T phi) {
+    const std::size_t window =
+        std::max(options.nonmonotone_window, std::size_t(1));
+    if (values_.size() < window) {
+      values_.push_back(phi);
+    } else {
+      // overwrite the oldest value
+      values_.resize(window);
+      head_ %= window;
+      values_[head_] = phi;
+      head_ = (head_ + 1) % window;
+    }
+    // Zhang-Hager update: weighted average of the past merit values
+    const T q = options.nonmonotone_eta * weight_ + 1.;
+    average_ = (options.nonmonotone_eta * weight_ * average_ + phi) / q;
+    weight_ = q;
+  }
+
+  /// Reference value; @p phi0 is the merit value at the current iterate.
+  T value(const Options &options, const T phi0) const {
+    if (values_.empty())
+      return phi0;
+    switch (options.nonmonotone) {
+    case LSNonmonotone::MAX:
+      return std::max(phi0, *std::max_element(values_.begin(), values_.end()));
+    case LSNonmonotone::AVERAGE:
+      return std::max(phi0, average_);
+    default:
+      return phi0;
+    }
+  }
+
+protected:
+  std::vector<T> values_; // ring buffer of the last merit values
+  std::size_t head_ = 0;
+  T average_ = 0.;
+  T weight_ = 0.;
+};
+
 } // namespace nlp
 } // namespace proxsuite
 
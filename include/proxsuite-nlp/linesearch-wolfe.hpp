@@ -0,0 +1,149 @@
+/// @file linesearch-wolfe.hpp
+/// @copyright Copyright (C) 2026 LAAS-CNRS, INRIA
+/// @brief  Implements a strong Wolfe line-search strategy.
+#pragma once
+
+#include "proxsuite-nlp/linesearch-base.hpp"
+#include "proxsuite-nlp/context.hpp"
+
+#include <cmath>
+#include <limits>
+
+namespace proxsuite {
+namespace nlp {
+
+/// @brief  Line-search enforcing the strong Wolfe conditions
+/// \f[
+///   \phi(\alpha) \leq \phi(0) + c_1\alpha\phi'(0),\quad
+///   |\phi'(\alpha)| \leq c_2 |\phi'(0)|,
+/// \f]
+/// using the bracketing and zoom phases of Nocedal & Wright (Algorithms 3.5
+/// and 3.6), with a maximum step size of 1.
+/// @details The derivative \f$\phi'(\alpha)\f$ is requested along with every
+/// trial value, so that the step size returned is always the last point
+/// evaluated when the conditions are met: its derivatives can be reused by the
+/// caller.
+template <typename Scalar>
+class WolfeLinesearch final : public Linesearch<Scalar> {
+public:
+  using Base = Linesearch<Scalar>;
+  using Base::options_;
+  using FunctionSample = typename Base::FunctionSample;
+
+  WolfeLinesearch(const typename Base::Options &options) : Base(options) {}
+
+  /// @param phi  Callable `Scalar(Scalar alpha, Scalar &dphi)` evaluating
+  /// \f$\phi(\alpha)\f$ and writing \f$\phi'(\alpha)\f$ to @p dphi. Failed
+  /// evaluations return a non-finite value.
+  template <typename Fn>
+  Scalar run(Fn &&phi, const Scalar phi0, const Scalar dphi0,
+             Scalar &alpha_try) {
+    const FunctionSample lower_bound(0., phi0, dphi0);
+    num_evals_ = 0;
+
+    alpha_try = 1.;
+    const FunctionSample full = evaluate(phi, alpha_try);
+    if (std::abs(dphi0) < options_.dphi_thresh) {
+      return full.phi;
+    }
+    if (!sufficientDecrease(full, lower_bound)) {
+      return zoom(phi, lower_bound, lower_bound, full, alpha_try);
+    }
+    if (curvature(full, lower_bound) || (full.dphi < 0.)) {
+      // the full step cannot be extended
+      return full.phi;
+    }
+    return zoom(phi, lower_bound, full, lower_bound, alpha_try);
+  }
+
+  /// Number of function evaluations of the last run.
+  std::size_t numEvals() const { return num_evals_; }
+
+protected:
+  std::size_t num_evals_ = 0;
+
+  template <typename Fn> FunctionSample evaluate(Fn &phi, const Scalar alpha) {
+    num_evals_++;
+    Scalar dphi = 0.;
+    const Scalar value = phi(alpha, dphi);
+    if (Base::isValid(value) && Base::isValid(dphi))
+      return FunctionSample(alpha, value, dphi);
+    FunctionSample failed(alpha, std::numeric_limits<Scalar>::infinity(), 0.);
+    failed.valid = false;
+    return failed;
+  }
+
+  bool sufficientDecrease(const FunctionSample &s,
+                          const FunctionSample &s0) const {
+    return s.valid &&
+           (s.phi - s0.phi <= options_.armijo_c1 * s.alpha * s0.dphi);
+  }
+
+  bool curvature(const FunctionSample &s, const FunctionSample &s0) const {
+    return std::abs(s.dphi) <= options_.wolfe_c2 * std::abs(s0.dphi);
+  }
+
+  /// Safeguarded minimizer of the cubic Hermite interpolant of the samples
+  /// @p lo and @p hi.
+  Scalar interpolate(const FunctionSample &lo, const FunctionSample &hi) const {
+    const Scalar a0 = lo.alpha, a1 = hi.alpha;
+    const Scalar mid = 0.5 * (a0 + a1);
+    if ((options_.interp_type == LSInterpolation::BISECTION) || !hi.valid)
+      return mid;
+    const Scalar d1 = lo.dphi + hi.dphi - 3. * (lo.phi - hi.phi) / (a0 - a1);
+    const Scalar disc = d1 * d1 - lo.dphi * hi.dphi;
+    if (disc < 0.)
+      return mid;
+    const Scalar d2 = std::copysign(std::sqrt(disc), a1 - a0);
+    const Scalar a =
+        a1 - (a1 - a0) * (hi.dphi + d2 - d1) / (hi.dphi - lo.dphi + 2. * d2);
+    // keep away from the interval bounds
+    const Scalar delta = 0.1 * std::abs(a1 - a0);
+    const Scalar amin = std::min(a0, a1) + delta;
+    const Scalar amax = std::max(a0, a1) - delta;
+    if (!std::isfinite(a) || (a < amin) || (a > amax))
+      return mid;
+    return a;
+  }
+
+  /// Zoom phase: the interval between @p lo and @p hi contains step sizes
+  /// satisfying the strong Wolfe conditions, and @p lo satisfies the
+  /// sufficient decrease condition.
+  template <typename Fn>
+  Scalar zoom(Fn &phi, const FunctionSample &s0, FunctionSample lo,
+              FunctionSample hi, Scalar &alpha_try) {
+    for (std::size_t i = 0; i < options_.max_num_steps; i++) {
+      if (std::abs(hi.alpha - lo.alpha) < options_.alpha_min)
+        break;
+      const FunctionSample cur = evaluate(phi, interpolate(lo, hi));
+      if (!sufficientDecrease(cur, s0) || (cur.phi >= lo.phi)) {
+        hi = cur;
+        continue;
+      }
+      if (curvature(cur, s0)) {
+        alpha_try = cur.alpha;
+        return cur.phi;
+      }
+      if (cur.dphi * (hi.alpha - lo.alpha) >= 0.)
+        hi = lo;
+      lo = cur;
+    }
+    // no step size satisfying both conditions was found
+    if (lo.alpha > 0.) {
+      alpha_try = lo.alpha;
+      return lo.phi;
+    }
+    // no step size with sufficient decrease either: fall back to the minimum
+    // step size, returning its own merit value
+    alpha_try = options_.alpha_min;
+    return evaluate(phi, alpha_try).phi;
+  }
+};
+
+#ifdef PROXSUITE_NLP_ENABLE_TEMPLATE_INSTANTIATION
+extern template class PROXSUITE_NLP_EXPLICIT_INSTANTIATION_DECLARATION_DLLAPI
+    WolfeLinesearch<context::Scalar>;
+#endif
+
+} // namespace nlp
+} // namespace proxsuite
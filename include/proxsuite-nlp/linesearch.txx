@@ -9,6 +9,8 @@ namespace nlp {
 
 extern template class PROXSUITE_NLP_EXPLICIT_INSTANTIATION_DECLARATION_DLLAPI
     Linesearch<context::Scalar>;
+extern template class PROXSUITE_NLP_EXPLICIT_INSTANTIATION_DECLARATION_DLLAPI
+    NonmonotoneReference<context::Scalar>;
 
 } // namespace nlp
 } // namespace proxsuite
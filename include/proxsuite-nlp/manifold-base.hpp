@@ -4,9 +4,23 @@
 
 #include "proxsuite-nlp/fwd.hpp"
 
+#include <vector>
+
 namespace proxsuite {
 namespace nlp {
 
+/// Structure of the Jacobians of the manifold operations, which functions of
+/// the manifold points (e.g. QuadraticDistanceCostTpl) can exploit.
+enum class JacobianStructure {
+  /// No particular structure.
+  DENSE,
+  /// Block-diagonal, with the blocks given by
+  /// ManifoldAbstractTpl::jacobianBlocks().
+  BLOCK_DIAGONAL,
+  /// Identity, up to sign: the manifold is a vector space.
+  IDENTITY
+};
+
 /**
  * Base class for manifolds, to use in cost funcs, solvers...
  */
@@ -41,6 +55,15 @@ public:
     return TangentSpaceType(this->ndx());
   }
 
+  /// @brief    Structure of the Jacobians of integrate() and difference().
+  virtual JacobianStructure jacobianStructure() const {
+    return JacobianStructure::DENSE;
+  }
+
+  /// @brief    Tangent dimensions of the diagonal blocks of the Jacobians of
+  /// integrate() and difference(), a dense Jacobian being a single block.
+  virtual std::vector<int> jacobianBlocks() const { return {ndx()}; }
+
   /// @name     Operations
 
   /// @brief Manifold integration operation \f$x \oplus v\f$
@@ -68,6 +91,30 @@ public:
   void interpolate(const ConstVectorRef &x0, const ConstVectorRef &x1,
                    const Scalar &u, VectorRef out) const;
 
+  /// \name Batched operations
+  /// The points and tangent vectors are the columns of the input and output
+  /// matrices. Jacobians are stacked horizontally, the output having
+  /// \f$N \times \mathrm{ndx}\f$ columns for \f$N\f$ points.
+  /// \{
+
+  /// @brief Apply integrate() to each column of @p X and @p V.
+  void integrate_batch(const ConstMatrixRef &X, const ConstMatrixRef &V,
+                       MatrixRef Xout) const;
+
+  /// @brief Apply difference() to each column of @p X0 and @p X1.
+  void difference_batch(const ConstMatrixRef &X0, const ConstMatrixRef &X1,
+                        MatrixRef Vout) const;
+
+  /// @brief Apply Jintegrate() to each column of @p X and @p V.
+  void Jintegrate_batch(const ConstMatrixRef &X, const ConstMatrixRef &V,
+                        MatrixRef Jout, int arg) const;
+
+  /// @brief Apply Jdifference() to each column of @p X0 and @p X1.
+  void Jdifference_batch(const ConstMatrixRef &X0, const ConstMatrixRef &X1,
+                         MatrixRef Jout, int arg) const;
+
+  /// \}
+
   /// \name Allocated overloads.
   /// \{
 
@@ -117,6 +164,40 @@ protected:
                                 const ConstVectorRef &x1, MatrixRef Jout,
                                 int arg) const = 0;
 
+  /// @brief    Batched integration; the default implementation loops over the
+  /// columns.
+  virtual void integrate_batch_impl(const ConstMatrixRef &X,
+                                    const ConstMatrixRef &V,
+                                    MatrixRef Xout) const {
+    for (Eigen::Index k = 0; k < X.cols(); k++)
+      integrate_impl(X.col(k), V.col(k), Xout.col(k));
+  }
+
+  /// @brief    Batched difference; the default implementation loops over the
+  /// columns.
+  virtual void difference_batch_impl(const ConstMatrixRef &X0,
+                                     const ConstMatrixRef &X1,
+                                     MatrixRef Vout) const {
+    for (Eigen::Index k = 0; k < X0.cols(); k++)
+      difference_impl(X0.col(k), X1.col(k), Vout.col(k));
+  }
+
+  virtual void Jintegrate_batch_impl(const ConstMatrixRef &X,
+                                     const ConstMatrixRef &V, MatrixRef Jout,
+                                     int arg) const {
+    const int n = ndx();
+    for (Eigen::Index k = 0; k < X.cols(); k++)
+      Jintegrate_impl(X.col(k), V.col(k), Jout.middleCols(k * n, n), arg);
+  }
+
+  virtual void Jdifference_batch_impl(const ConstMatrixRef &X0,
+                                      const ConstMatrixRef &X1, MatrixRef Jout,
+                                      int arg) const {
+    const int n = ndx();
+    for (Eigen::Index k = 0; k < X0.cols(); k++)
+      Jdifference_impl(X0.col(k), X1.col(k), Jout.middleCols(k * n, n), arg);
+  }
+
   /// @brief    Interpolation operation.
   virtual void interpolate_impl(const ConstVectorRef &x0,
                                 const ConstVectorRef &x1, const Scalar &u,
@@ -49,5 +49,37 @@ void ManifoldAbstractTpl<Scalar, Options>::interpolate(const ConstVectorRef &x0,
   interpolate_impl(x0, x1, u, out);
 }
 
+/* Batched operations */
+
+template <typename Scalar, int Options>
+void ManifoldAbstractTpl<Scalar, Options>::integrate_batch(
+    const ConstMatrixRef &X, const ConstMatrixRef &V, MatrixRef Xout) const {
+  assert(X.cols() == V.cols() && X.cols() == Xout.cols());
+  integrate_batch_impl(X, V, Xout);
+}
+
+template <typename Scalar, int Options>
+void ManifoldAbstractTpl<Scalar, Options>::difference_batch(
+    const ConstMatrixRef &X0, const ConstMatrixRef &X1, MatrixRef Vout) const {
+  assert(X0.cols() == X1.cols() && X0.cols() == Vout.cols());
+  difference_batch_impl(X0, X1, Vout);
+}
+
+template <typename Scalar, int Options>
+void ManifoldAbstractTpl<Scalar, Options>::Jintegrate_batch(
+    const ConstMatrixRef &X, const ConstMatrixRef &V, MatrixRef Jout,
+    int arg) const {
+  assert(X.cols() == V.cols() && X.cols() * ndx() == Jout.cols());
+  Jintegrate_batch_impl(X, V, Jout, arg);
+}
+
+template <typename Scalar, int Options>
+void ManifoldAbstractTpl<Scalar, Options>::Jdifference_batch(
+    const ConstMatrixRef &X0, const ConstMatrixRef &X1, MatrixRef Jout,
+    int arg) const {
+  assert(X0.cols() == X1.cols() && X0.cols() * ndx() == Jout.cols());
+  Jdifference_batch_impl(X0, X1, Jout, arg);
+}
+
 } // namespace nlp
 } // namespace proxsuite
@@ -0,0 +1,110 @@
+/// @file
+/// @copyright Copyright (C) 2026 LAAS-CNRS, INRIA
+/// @brief     Forward-mode automatic differentiation of user-written functors.
+#pragma once
+
+#include "proxsuite-nlp/function-base.hpp"
+
+#include <unsupported/Eigen/AutoDiff>
+
+namespace proxsuite {
+namespace nlp {
+namespace autodiff {
+
+/**
+ * @brief   Twice-differentiable function whose derivatives are computed by
+ * operator-overloading automatic differentiation of a functor.
+ *
+ * @details The functor must be callable on an
+ * `Eigen::Matrix<T, Eigen::Dynamic, 1>` for `T = Scalar` and the dual number
+ * types ADScalar and AD2Scalar, and return a vector with the same scalar type,
+ * e.g.
+ * @code
+ * struct MyFunctor {
+ *   template <typename T>
+ *   Eigen::Matrix<T, -1, 1> operator()(const Eigen::Matrix<T, -1, 1> &x) const;
+ * };
+ * @endcode
+ * Elementary functions should be called unqualified (`using std::sin;
+ * sin(x(0))`) so that the dual-number overloads are found.
+ *
+ * The Jacobian is obtained in a single evaluation with dual numbers carrying
+ * all @f$ n_{dx} @f$ tangent directions at once. The vector-Hessian product is
+ * obtained in a single evaluation with second-order (nested) dual numbers.
+ *
+ * @warning The input space is assumed to be Euclidean (@f$ n_x = n_{dx} @f$).
+ */
+template <typename _Scalar, typename Functor>
+struct AutoDiffFunctionTpl : C2FunctionTpl<_Scalar> {
+  using Scalar = _Scalar;
+  PROXSUITE_NLP_DYNAMIC_TYPEDEFS(Scalar);
+  using Base = C2FunctionTpl<Scalar>;
+  using Base::computeJacobian;
+
+  /// First-order dual number, carrying one tangent per input direction.
+  using ADScalar = Eigen::AutoDiffScalar<VectorXs>;
+  using ADVector = Eigen::Matrix<ADScalar, Eigen::Dynamic, 1>;
+  /// Second-order dual number (dual number over first-order dual numbers).
+  using AD2Scalar = Eigen::AutoDiffScalar<ADVector>;
+  using AD2Vector = Eigen::Matrix<AD2Scalar, Eigen::Dynamic, 1>;
+
+  Functor functor_;
+
+  AutoDiffFunctionTpl(const int nx, const int nr, const Functor &functor)
+      : Base(nx, nx, nr), functor_(functor) {}
+
+  VectorXs operator()(const ConstVectorRef &x) const override {
+    const VectorXs xin = x;
+    return functor_(xin);
+  }
+
+  void computeJacobian(const ConstVectorRef &x, MatrixRef Jout) const override {
+    const int ndx = this->ndx();
+    ADVector xad(ndx);
+    for (int i = 0; i < ndx; i++) {
+      xad(i) = ADScalar(x(i), ndx, i);
+    }
+    const ADVector yad = functor_(xad);
+    for (int j = 0; j < this->nr(); j++) {
+      // outputs which do not depend on x carry no derivatives
+      if (yad(j).derivatives().size() == 0)
+        Jout.row(j).setZero();
+      else
+        Jout.row(j) = yad(j).derivatives().transpose();
+    }
+  }
+
+  void vectorHessianProduct(const ConstVectorRef &x, const ConstVectorRef &v,
+                            MatrixRef Hout) const override {
+    const int ndx = this->ndx();
+    AD2Vector xad(ndx);
+    for (int i = 0; i < ndx; i++) {
+      xad(i).value() = ADScalar(x(i), ndx, i);
+      ADVector &dxi = xad(i).derivatives();
+      dxi.resize(ndx);
+      for (int k = 0; k < ndx; k++) {
+        dxi(k) = ADScalar(Scalar(k == i), VectorXs::Zero(ndx));
+      }
+    }
+    const AD2Vector yad = functor_(xad);
+    Hout.setZero();
+    for (int j = 0; j < this->nr(); j++) {
+      const ADVector &dyj = yad(j).derivatives();
+      for (Eigen::Index k = 0; k < dyj.size(); k++) {
+        if (dyj(k).derivatives().size() > 0)
+          Hout.row(k) += v(j) * dyj(k).derivatives().transpose();
+      }
+    }
+  }
+};
+
+/// @brief Create an AutoDiffFunctionTpl from a functor.
+template <typename Scalar, typename Functor>
+auto makeAutoDiffFunction(const int nx, const int nr, const Functor &functor) {
+  return std::make_shared<AutoDiffFunctionTpl<Scalar, Functor>>(nx, nr,
+                                                                functor);
+}
+
+} // namespace autodiff
+} // namespace nlp
+} // namespace proxsuite
@@ -8,4 +8,6 @@
 #include "proxsuite-nlp/modelling/constraints/negative-orthant.hpp"
 #include "proxsuite-nlp/modelling/constraints/box-constraint.hpp"
 #include "proxsuite-nlp/modelling/constraints/l1-penalty.hpp"
+#include "proxsuite-nlp/modelling/constraints/second-order-cone.hpp"
+#include "proxsuite-nlp/modelling/constraints/positive-semidefinite-cone.hpp"
 #include "proxsuite-nlp/modelling/constraints/constraint-set-product.hpp"
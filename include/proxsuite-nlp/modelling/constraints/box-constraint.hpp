@@ -42,6 +42,36 @@ template <typename Scalar> struct BoxConstraintTpl : ConstraintSetTpl<Scalar> {
     out.array() =
         (z.array() > upper_limit.array()) || (z.array() < lower_limit.array());
   }
+
+  bool hasDiagonalProjectionJacobian() const { return true; }
+
+  /// The normal cone projection is zero wherever the projection Jacobian is
+  /// nonzero, hence the reprojections vanish.
+  void computeAll(const ConstVectorRef &z, const ConstVectorRef &zpdal,
+                  VectorRef zncp, VectorRef zncp_pdal, VectorRef zncp_reproj,
+                  VectorRef zncp_pdal_reproj, Eigen::Ref<ActiveType> active,
+                  Eigen::Ref<ActiveType> active_pdal) const {
+    zncp = z - projection_impl(z);
+    zncp_pdal = zpdal - projection_impl(zpdal);
+    zncp_reproj.setZero();
+    zncp_pdal_reproj.setZero();
+    computeActiveSet(z, active);
+    computeActiveSet(zpdal, active_pdal);
+  }
+
+  /// Concatenates the limits of both boxes.
+  bool tryMerge(const Base &other) {
+    if (typeid(other) != typeid(*this))
+      return false;
+    const auto &box = static_cast<const BoxConstraintTpl &>(other);
+    const long n = lower_limit.size();
+    const long m = box.lower_limit.size();
+    lower_limit.conservativeResize(n + m);
+    upper_limit.conservativeResize(n + m);
+    lower_limit.tail(m) = box.lower_limit;
+    upper_limit.tail(m) = box.upper_limit;
+    return true;
+  }
 };
 
 #ifdef PROXSUITE_NLP_ENABLE_TEMPLATE_INSTANTIATION
@@ -4,6 +4,10 @@
 
 namespace proxsuite {
 namespace nlp {
+/// @brief Get the @p rowIdx-th row block of @p matrix.
+/// @note The block offset is recomputed, in linear time: when accessing all
+/// the blocks, precompute the offsets (see
+/// ConstraintSetProductTpl::blockOffsets()).
 template <typename Derived>
 auto blockMatrixGetRow(const Eigen::MatrixBase<Derived> &matrix,
                        const std::vector<Eigen::Index> &rowBlockSizes,
@@ -16,6 +20,8 @@ auto blockMatrixGetRow(const Eigen::MatrixBase<Derived> &matrix,
                                                 rowBlockSizes[rowIdx]);
 }
 
+/// @brief Get the @p blockIdx-th segment of the vector @p matrix.
+/// @note Linear in @p blockIdx, see blockMatrixGetRow().
 template <typename Derived>
 auto blockVectorGetRow(const Eigen::MatrixBase<Derived> &matrix,
                        const std::vector<Eigen::Index> &blockSizes,
@@ -31,7 +37,11 @@ auto blockVectorGetRow(const Eigen::MatrixBase<Derived> &matrix,
 /// @brief Cartesian product of multiple constraint sets.
 /// This class makes computing multipliers and Jacobian matrix projections more
 /// convenient.
-/// @warning This struct contains a non-owning vector of its component sets.
+/// @details The block offsets are precomputed, and contiguous components of
+/// the same type are merged (see ConstraintSetTpl::tryMerge()) so that the
+/// operators are dispatched once per batch of like components.
+/// @warning The product holds copies of its component sets: modifying the
+/// sets passed to the constructor has no effect on it.
 template <typename Scalar>
 struct ConstraintSetProductTpl : ConstraintSetTpl<Scalar> {
   PROXSUITE_NLP_DYNAMIC_TYPEDEFS(Scalar);
@@ -45,6 +55,12 @@ struct ConstraintSetProductTpl : ConstraintSetTpl<Scalar> {
       PROXSUITE_NLP_RUNTIME_ERROR("Number of components and corresponding "
                                   "block sizes should be the same.");
     }
+    m_blockOffsets.resize(blockSizes.size() + 1);
+    m_blockOffsets[0] = 0;
+    for (std::size_t i = 0; i < blockSizes.size(); i++) {
+      m_blockOffsets[i + 1] = m_blockOffsets[i] + blockSizes[i];
+    }
+    initBatches();
   }
 
   ConstraintSetProductTpl(const ConstraintSetProductTpl &) = default;
@@ -54,54 +70,67 @@ struct ConstraintSetProductTpl : ConstraintSetTpl<Scalar> {
 
   Scalar evaluate(const ConstVectorRef &zproj) const override {
     Scalar res = 0.;
-    for (std::size_t i = 0; i < m_components.size(); i++) {
-      auto zblock = blockVectorGetRow(zproj, m_blockSizes, i);
-      res += m_components[i]->evaluate(zblock);
+    for (std::size_t k = 0; k < m_batches.size(); k++) {
+      res += m_batches[k]->evaluate(batchBlock(zproj, k));
     }
     return res;
   }
 
   void projection(const ConstVectorRef &z, VectorRef zout) const override {
-    for (std::size_t i = 0; i < m_components.size(); i++) {
-      ConstVectorRef inblock = blockVectorGetRow(z, m_blockSizes, i);
-      VectorRef outblock = blockVectorGetRow(zout, m_blockSizes, i);
-      m_components[i]->projection(inblock, outblock);
+    for (std::size_t k = 0; k < m_batches.size(); k++) {
+      m_batches[k]->projection(batchBlock(z, k), batchBlock(zout, k));
     }
   }
 
   void normalConeProjection(const ConstVectorRef &z,
                             VectorRef zout) const override {
-    for (std::size_t i = 0; i < m_components.size(); i++) {
-      ConstVectorRef inblock = blockVectorGetRow(z, m_blockSizes, i);
-      VectorRef outblock = blockVectorGetRow(zout, m_blockSizes, i);
-      m_components[i]->normalConeProjection(inblock, outblock);
+    for (std::size_t k = 0; k < m_batches.size(); k++) {
+      m_batches[k]->normalConeProjection(batchBlock(z, k),
+                                         batchBlock(zout, k));
     }
   }
 
   void applyProjectionJacobian(const ConstVectorRef &z,
                                MatrixRef Jout) const override {
-    for (std::size_t i = 0; i < m_components.size(); i++) {
-      ConstVectorRef inblock = blockVectorGetRow(z, m_blockSizes, i);
-      MatrixRef outblock = blockMatrixGetRow(Jout, m_blockSizes, i);
-      m_components[i]->applyProjectionJacobian(inblock, outblock);
+    for (std::size_t k = 0; k < m_batches.size(); k++) {
+      m_batches[k]->applyProjectionJacobian(batchBlock(z, k),
+                                            batchBlock(Jout, k));
     }
   }
 
   void applyNormalConeProjectionJacobian(const ConstVectorRef &z,
                                          MatrixRef Jout) const override {
-    for (std::size_t i = 0; i < m_components.size(); i++) {
-      ConstVectorRef inblock = blockVectorGetRow(z, m_blockSizes, i);
-      MatrixRef outblock = blockMatrixGetRow(Jout, m_blockSizes, i);
-      m_components[i]->applyNormalConeProjectionJacobian(inblock, outblock);
+    for (std::size_t k = 0; k < m_batches.size(); k++) {
+      m_batches[k]->applyNormalConeProjectionJacobian(batchBlock(z, k),
+                                                      batchBlock(Jout, k));
     }
   }
 
   void computeActiveSet(const ConstVectorRef &z,
                         Eigen::Ref<ActiveType> out) const override {
-    for (std::size_t i = 0; i < m_components.size(); i++) {
-      ConstVectorRef inblock = blockVectorGetRow(z, m_blockSizes, i);
-      decltype(out) outblock = blockVectorGetRow(out, m_blockSizes, i);
-      m_components[i]->computeActiveSet(inblock, outblock);
+    for (std::size_t k = 0; k < m_batches.size(); k++) {
+      m_batches[k]->computeActiveSet(batchBlock(z, k), batchBlock(out, k));
+    }
+  }
+
+  bool hasDiagonalProjectionJacobian() const override {
+    for (const auto &c : m_batches) {
+      if (!c->hasDiagonalProjectionJacobian())
+        return false;
+    }
+    return true;
+  }
+
+  void computeAll(const ConstVectorRef &z, const ConstVectorRef &zpdal,
+                  VectorRef zncp, VectorRef zncp_pdal, VectorRef zncp_reproj,
+                  VectorRef zncp_pdal_reproj, Eigen::Ref<ActiveType> active,
+                  Eigen::Ref<ActiveType> active_pdal) const override {
+    for (std::size_t k = 0; k < m_batches.size(); k++) {
+      m_batches[k]->computeAll(
+          batchBlock(z, k), batchBlock(zpdal, k), batchBlock(zncp, k),
+          batchBlock(zncp_pdal, k), batchBlock(zncp_reproj, k),
+          batchBlock(zncp_pdal_reproj, k), batchBlock(active, k),
+          batchBlock(active_pdal, k));
     }
   }
 
@@ -109,10 +138,44 @@ struct ConstraintSetProductTpl : ConstraintSetTpl<Scalar> {
     return m_components;
   }
   const std::vector<Eigen::Index> &blockSizes() const { return m_blockSizes; }
+  /// Start index of each block, followed by the total dimension.
+  const std::vector<Eigen::Index> &blockOffsets() const {
+    return m_blockOffsets;
+  }
+  /// Number of batches of merged components the operators are dispatched to.
+  std::size_t numBatches() const { return m_batches.size(); }
 
 private:
   std::vector<xyz::polymorphic<Base>> m_components;
   std::vector<Eigen::Index> m_blockSizes;
+  std::vector<Eigen::Index> m_blockOffsets;
+  /// Merged runs of contiguous like components.
+  std::vector<xyz::polymorphic<Base>> m_batches;
+  /// Start index of each batch, followed by the total dimension.
+  std::vector<Eigen::Index> m_batchOffsets;
+
+  void initBatches() {
+    m_batches.clear();
+    m_batchOffsets.assign(1, 0);
+    for (std::size_t i = 0; i < m_components.size(); i++) {
+      const Base &comp = *m_components[i];
+      // components with different prox parameters are kept apart
+      if (!m_batches.empty() && m_batches.back()->mu() == comp.mu() &&
+          m_batches.back()->tryMerge(comp)) {
+        m_batchOffsets.back() = m_blockOffsets[i + 1];
+        continue;
+      }
+      m_batches.push_back(m_components[i]);
+      m_batchOffsets.push_back(m_blockOffsets[i + 1]);
+    }
+  }
+
+  template <typename Derived>
+  auto batchBlock(const Eigen::MatrixBase<Derived> &matrix,
+                  std::size_t k) const {
+    return matrix.const_cast_derived().middleRows(
+        m_batchOffsets[k], m_batchOffsets[k + 1] - m_batchOffsets[k]);
+  }
 };
 
 #ifdef PROXSUITE_NLP_ENABLE_TEMPLATE_INSTANTIATION
@@ -54,6 +54,23 @@ public:
                                Eigen::Ref<ActiveType> out) const {
     out.array() = true;
   }
+
+  bool hasDiagonalProjectionJacobian() const { return true; }
+
+  inline void computeAll(const ConstVectorRef &z, const ConstVectorRef &zpdal,
+                         VectorRef zncp, VectorRef zncp_pdal,
+                         VectorRef zncp_reproj, VectorRef zncp_pdal_reproj,
+                         Eigen::Ref<ActiveType> active,
+                         Eigen::Ref<ActiveType> active_pdal) const {
+    zncp = z;
+    zncp_pdal = zpdal;
+    zncp_reproj.setZero();
+    zncp_pdal_reproj.setZero();
+    active.array() = true;
+    active_pdal.array() = true;
+  }
+
+  bool tryMerge(const Base &other) { return typeid(other) == typeid(*this); }
 };
 
 template <typename Scalar>
@@ -50,6 +50,26 @@ struct NonsmoothPenaltyL1Tpl : ConstraintSetTpl<_Scalar> {
                         Eigen::Ref<ActiveType> out) const {
     out = z.array().abs() <= mu_;
   }
+
+  bool hasDiagonalProjectionJacobian() const { return true; }
+
+  void computeAll(const ConstVectorRef &z, const ConstVectorRef &zpdal,
+                  VectorRef zncp, VectorRef zncp_pdal, VectorRef zncp_reproj,
+                  VectorRef zncp_pdal_reproj, Eigen::Ref<ActiveType> active,
+                  Eigen::Ref<ActiveType> active_pdal) const {
+    // the normal cone projection is the clamp to [-mu, mu]
+    zncp = z.cwiseMax(-mu_).cwiseMin(mu_);
+    zncp_pdal = zpdal.cwiseMax(-mu_).cwiseMin(mu_);
+    active = z.array().abs() <= mu_;
+    active_pdal = zpdal.array().abs() <= mu_;
+    // the soft-thresholding Jacobian is zero on the active set
+    zncp_reproj = active.select(VectorXs::Zero(z.size()), zncp);
+    zncp_pdal_reproj =
+        active_pdal.select(VectorXs::Zero(zpdal.size()), zncp_pdal);
+  }
+
+  /// Blocks are merged assuming they share the same proximal parameter.
+  bool tryMerge(const Base &other) { return typeid(other) == typeid(*this); }
 };
 
 #ifdef PROXSUITE_NLP_ENABLE_TEMPLATE_INSTANTIATION
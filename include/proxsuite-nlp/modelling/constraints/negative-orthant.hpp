@@ -42,6 +42,24 @@ struct NegativeOrthantTpl : ConstraintSetTpl<_Scalar> {
                         Eigen::Ref<ActiveType> out) const {
     out.array() = (z.array() > static_cast<Scalar>(0.));
   }
+
+  bool hasDiagonalProjectionJacobian() const { return true; }
+
+  /// The normal cone projection is zero wherever the projection Jacobian is
+  /// nonzero, hence the reprojections vanish.
+  void computeAll(const ConstVectorRef &z, const ConstVectorRef &zpdal,
+                  VectorRef zncp, VectorRef zncp_pdal, VectorRef zncp_reproj,
+                  VectorRef zncp_pdal_reproj, Eigen::Ref<ActiveType> active,
+                  Eigen::Ref<ActiveType> active_pdal) const {
+    zncp = z.cwiseMax(static_cast<Scalar>(0.));
+    zncp_pdal = zpdal.cwiseMax(static_cast<Scalar>(0.));
+    zncp_reproj.setZero();
+    zncp_pdal_reproj.setZero();
+    active.array() = (z.array() > static_cast<Scalar>(0.));
+    active_pdal.array() = (zpdal.array() > static_cast<Scalar>(0.));
+  }
+
+  bool tryMerge(const Base &other) { return typeid(other) == typeid(*this); }
 };
 
 template <typename Scalar>
@@ -0,0 +1,199 @@
+/// @file
+/// @copyright Copyright (C) 2026 LAAS-CNRS, INRIA
+#pragma once
+
+#include "proxsuite-nlp/constraint-set.hpp"
+
+#include <Eigen/Jacobi>
+
+#include <limits>
+
+namespace proxsuite {
+namespace nlp {
+
+/**
+ * @brief   Cone of positive semidefinite matrices
+ * \f$ \calK = \{ Z \in \RR^{n\times n} : Z = Z^\top \succeq 0 \} \f$.
+ *
+ * @details The matrix \f$Z\f$ is stored as its column-major vectorization,
+ * of size \f$n^2\f$. The projection is obtained by clamping the eigenvalues of
+ * the symmetric part of \f$Z\f$; this set is meant for small matrices, since
+ * each call performs a dense eigendecomposition (cyclic Jacobi method).
+ * The decomposition and its buffers are members of the set, so that the
+ * operators do not allocate memory: the solver workspace holds its own copy
+ * of the sets, but an instance must not be used from several threads.
+ */
+template <typename _Scalar>
+struct PositiveSemidefiniteConeTpl : ConstraintSetTpl<_Scalar> {
+  using Scalar = _Scalar;
+  PROXSUITE_NLP_DYNAMIC_TYPEDEFS(Scalar);
+
+  using Base = ConstraintSetTpl<Scalar>;
+  using ActiveType = typename Base::ActiveType;
+
+  /// @param n  Matrix size.
+  explicit PositiveSemidefiniteConeTpl(const int n)
+      : n_(checkSize(n)), eigvecs_(n, n), eigvals_(n), sym_(n, n), buf_(n, n),
+        tmp_(n, n), gamma_(n, n), lam_pos_(n) {}
+  PositiveSemidefiniteConeTpl(const PositiveSemidefiniteConeTpl &) = default;
+  PositiveSemidefiniteConeTpl &
+  operator=(const PositiveSemidefiniteConeTpl &) = default;
+  PositiveSemidefiniteConeTpl(PositiveSemidefiniteConeTpl &&) = default;
+  PositiveSemidefiniteConeTpl &
+  operator=(PositiveSemidefiniteConeTpl &&) = default;
+
+  /// Matrix size.
+  int n() const { return n_; }
+
+  void projection(const ConstVectorRef &z, VectorRef zout) const {
+    computeProjection(z);
+    zout = Eigen::Map<const VectorXs>(buf_.data(), n_ * n_);
+  }
+
+  void normalConeProjection(const ConstVectorRef &z, VectorRef zout) const {
+    computeProjection(z);
+    zout = z - Eigen::Map<const VectorXs>(buf_.data(), n_ * n_);
+  }
+
+  /// The projection Jacobian acts on a direction \f$H\f$ as
+  /// \f$ V (\Gamma \circ V^\top \mathrm{sym}(H) V) V^\top \f$, where
+  /// \f$\Gamma_{ij}\f$ is the divided difference of \f$\max(\cdot, 0)\f$ at the
+  /// eigenvalues \f$\lambda_i, \lambda_j\f$.
+  void applyProjectionJacobian(const ConstVectorRef &z, MatrixRef Jout) const {
+    applyJacobianImpl(z, Jout, false);
+  }
+
+  void applyNormalConeProjectionJacobian(const ConstVectorRef &z,
+                                         MatrixRef Jout) const {
+    applyJacobianImpl(z, Jout, true);
+  }
+
+  /// All the components are active whenever the symmetric part of @p z has a
+  /// negative eigenvalue.
+  void computeActiveSet(const ConstVectorRef &z,
+                        Eigen::Ref<ActiveType> out) const {
+    decompose(z, false);
+    out.setConstant(eigvals_.minCoeff() < 0.);
+  }
+
+  /// The projection Jacobian vanishes on the normal cone projection, hence
+  /// the reprojections are zero; each input is decomposed once.
+  void computeAll(const ConstVectorRef &z, const ConstVectorRef &zpdal,
+                  VectorRef zncp, VectorRef zncp_pdal, VectorRef zncp_reproj,
+                  VectorRef zncp_pdal_reproj, Eigen::Ref<ActiveType> active,
+                  Eigen::Ref<ActiveType> active_pdal) const {
+    normalConeProjection(z, zncp);
+    active.setConstant(eigvals_.minCoeff() < 0.);
+    normalConeProjection(zpdal, zncp_pdal);
+    active_pdal.setConstant(eigvals_.minCoeff() < 0.);
+    zncp_reproj.setZero();
+    zncp_pdal_reproj.setZero();
+  }
+
+  /// Maximum number of sweeps of the Jacobi eigenvalue algorithm, which
+  /// converges quadratically.
+  static constexpr int max_sweeps = 50;
+
+protected:
+  int n_;
+  /// @name Workspace
+  /// Allocated by the constructor.
+  /// @{
+  mutable MatrixXs eigvecs_;
+  mutable VectorXs eigvals_;
+  mutable MatrixXs sym_;
+  mutable MatrixXs buf_;
+  mutable MatrixXs tmp_;
+  mutable MatrixXs gamma_;
+  mutable VectorXs lam_pos_;
+  /// @}
+
+  static int checkSize(const int n) {
+    if (n <= 0)
+      PROXSUITE_NLP_RUNTIME_ERROR(
+          fmt::format("Invalid matrix size {:d} for the PSD cone.", n));
+    return n;
+  }
+
+  /// Eigendecomposition \f$V\Lambda V^\top\f$ of the symmetric part of @p z,
+  /// stored in eigvals_ and eigvecs_ (unsorted), by cyclic Jacobi rotations.
+  void decompose(const ConstVectorRef &z, bool eigenvectors = true) const {
+    if (z.size() != n_ * n_)
+      PROXSUITE_NLP_RUNTIME_ERROR(
+          fmt::format("Input size {:d} does not match the PSD cone of "
+                      "{:d}x{:d} matrices.",
+                      z.size(), n_, n_));
+    Eigen::Map<const MatrixXs> Z(z.data(), n_, n_);
+    MatrixXs &A = sym_;
+    A = Scalar(0.5) * (Z + Z.transpose());
+    if (eigenvectors)
+      eigvecs_.setIdentity();
+    const Scalar eps = std::numeric_limits<Scalar>::epsilon();
+    const Scalar tol = eps * eps * A.squaredNorm();
+    Eigen::JacobiRotation<Scalar> rot;
+    for (int sweep = 0; sweep < max_sweeps; sweep++) {
+      Scalar off = 0.;
+      for (int q = 1; q < n_; q++)
+        off += A.col(q).head(q).squaredNorm();
+      if (off <= tol)
+        break;
+      for (int q = 1; q < n_; q++) {
+        for (int p = 0; p < q; p++) {
+          if (A(p, q) == Scalar(0.))
+            continue;
+          rot.makeJacobi(A, p, q);
+          A.applyOnTheLeft(p, q, rot.adjoint());
+          A.applyOnTheRight(p, q, rot);
+          if (eigenvectors)
+            eigvecs_.applyOnTheRight(p, q, rot);
+        }
+      }
+    }
+    eigvals_ = A.diagonal();
+  }
+
+  /// Store the projection of @p z in buf_.
+  void computeProjection(const ConstVectorRef &z) const {
+    decompose(z);
+    const MatrixXs &V = eigvecs_;
+    lam_pos_ = eigvals_.cwiseMax(Scalar(0.));
+    tmp_.noalias() = V * lam_pos_.asDiagonal();
+    buf_.noalias() = tmp_ * V.transpose();
+  }
+
+  void applyJacobianImpl(const ConstVectorRef &z, MatrixRef Jout,
+                         const bool normal) const {
+    decompose(z);
+    const MatrixXs &V = eigvecs_;
+    const VectorXs &lam = eigvals_;
+    lam_pos_ = lam.cwiseMax(Scalar(0.));
+    for (int j = 0; j < n_; j++) {
+      for (int i = 0; i < n_; i++) {
+        if ((lam(i) > 0.) == (lam(j) > 0.))
+          gamma_(i, j) = lam(i) > 0. ? 1. : 0.;
+        else
+          gamma_(i, j) = (lam_pos_(i) - lam_pos_(j)) / (lam(i) - lam(j));
+      }
+    }
+    for (long c = 0; c < Jout.cols(); c++) {
+      Eigen::Map<MatrixXs> H(Jout.col(c).data(), n_, n_);
+      sym_ = Scalar(0.5) * (H + H.transpose());
+      tmp_.noalias() = V.transpose() * sym_;
+      buf_.noalias() = tmp_ * V;
+      buf_ = gamma_.cwiseProduct(buf_);
+      tmp_.noalias() = V * buf_;
+      if (normal)
+        H.noalias() -= tmp_ * V.transpose();
+      else
+        H.noalias() = tmp_ * V.transpose();
+    }
+  }
+};
+
+#ifdef PROXSUITE_NLP_ENABLE_TEMPLATE_INSTANTIATION
+extern template struct PROXSUITE_NLP_EXPLICIT_INSTANTIATION_DECLARATION_DLLAPI
+    PositiveSemidefiniteConeTpl<context::Scalar>;
+#endif
+
+} // namespace nlp
+} // namespace proxsuite
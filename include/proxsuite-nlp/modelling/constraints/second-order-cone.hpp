@@ -0,0 +1,170 @@
+/// @file
+/// @copyright Copyright (C) 2026 LAAS-CNRS, INRIA
+#pragma once
+
+#include "proxsuite-nlp/constraint-set.hpp"
+
+namespace proxsuite {
+namespace nlp {
+
+/**
+ * @brief   Second-order (Lorentz) cone
+ * \f$ \calK = \{ z = (t, x) \in \RR \times \RR^{n} : \|x\| \leq t \} \f$.
+ *
+ * @details The first component of the input is the scalar part \f$t\f$. The
+ * cone is self-dual, and its projection has the closed form
+ * \f[
+ *    \proj_\calK(t, x) = \frac{t + \|x\|}{2} \left(1, \frac{x}{\|x\|}\right)
+ * \f]
+ * when \f$\|x\| > |t|\f$. The projection Jacobian couples all the
+ * components, hence it is applied as a dense operator on the constraint block.
+ */
+template <typename _Scalar>
+struct SecondOrderConeTpl : ConstraintSetTpl<_Scalar> {
+  using Scalar = _Scalar;
+  PROXSUITE_NLP_DYNAMIC_TYPEDEFS(Scalar);
+
+  SecondOrderConeTpl() = default;
+  SecondOrderConeTpl(const SecondOrderConeTpl &) = default;
+  SecondOrderConeTpl &operator=(const SecondOrderConeTpl &) = default;
+  SecondOrderConeTpl(SecondOrderConeTpl &&) = default;
+  SecondOrderConeTpl &operator=(SecondOrderConeTpl &&) = default;
+
+  using Base = ConstraintSetTpl<Scalar>;
+  using ActiveType = typename Base::ActiveType;
+
+  /// Location of a point w.r.t. the cone, which determines the expression of
+  /// the projection.
+  enum Region { INTERIOR, POLAR, BOUNDARY };
+
+  static Region region(const ConstVectorRef &z, Scalar &r) {
+    r = z.tail(z.size() - 1).norm();
+    if (r <= z(0))
+      return INTERIOR;
+    if (r <= -z(0))
+      return POLAR;
+    return BOUNDARY;
+  }
+
+  void projection(const ConstVectorRef &z, VectorRef zout) const {
+    Scalar r;
+    const Scalar t = z(0);
+    const long n = z.size() - 1;
+    switch (region(z, r)) {
+    case INTERIOR:
+      zout = z;
+      break;
+    case POLAR:
+      zout.setZero();
+      break;
+    case BOUNDARY:
+      zout.tail(n) = static_cast<Scalar>(0.5) * (1. + t / r) * z.tail(n);
+      zout(0) = static_cast<Scalar>(0.5) * (r + t);
+      break;
+    }
+  }
+
+  void normalConeProjection(const ConstVectorRef &z, VectorRef zout) const {
+    Scalar r;
+    const Scalar t = z(0);
+    const long n = z.size() - 1;
+    switch (region(z, r)) {
+    case INTERIOR:
+      zout.setZero();
+      break;
+    case POLAR:
+      zout = z;
+      break;
+    case BOUNDARY:
+      zout.tail(n) = static_cast<Scalar>(0.5) * (1. - t / r) * z.tail(n);
+      zout(0) = static_cast<Scalar>(0.5) * (t - r);
+      break;
+    }
+  }
+
+  /// On the boundary region, with \f$u = x / \|x\|\f$ and \f$s = t/\|x\|\f$,
+  /// the projection Jacobian is
+  /// \f[
+  ///   P = \frac{1}{2}\begin{bmatrix} 1 & u^\top \\ u & (1+s)I - s uu^\top
+  ///   \end{bmatrix}.
+  /// \f]
+  void applyProjectionJacobian(const ConstVectorRef &z, MatrixRef Jout) const {
+    Scalar r;
+    switch (region(z, r)) {
+    case INTERIOR:
+      break;
+    case POLAR:
+      Jout.setZero();
+      break;
+    case BOUNDARY:
+      applyBoundaryJacobian(z, r, Jout, false);
+      break;
+    }
+  }
+
+  void applyNormalConeProjectionJacobian(const ConstVectorRef &z,
+                                         MatrixRef Jout) const {
+    Scalar r;
+    switch (region(z, r)) {
+    case INTERIOR:
+      Jout.setZero();
+      break;
+    case POLAR:
+      break;
+    case BOUNDARY:
+      applyBoundaryJacobian(z, r, Jout, true);
+      break;
+    }
+  }
+
+  /// All the components are active whenever @p z is outside of the interior of
+  /// the cone.
+  void computeActiveSet(const ConstVectorRef &z,
+                        Eigen::Ref<ActiveType> out) const {
+    Scalar r;
+    out.setConstant(region(z, r) != INTERIOR);
+  }
+
+  /// The projection Jacobian vanishes on the normal cone projection, hence
+  /// the reprojections are zero.
+  void computeAll(const ConstVectorRef &z, const ConstVectorRef &zpdal,
+                  VectorRef zncp, VectorRef zncp_pdal, VectorRef zncp_reproj,
+                  VectorRef zncp_pdal_reproj, Eigen::Ref<ActiveType> active,
+                  Eigen::Ref<ActiveType> active_pdal) const {
+    normalConeProjection(z, zncp);
+    normalConeProjection(zpdal, zncp_pdal);
+    zncp_reproj.setZero();
+    zncp_pdal_reproj.setZero();
+    computeActiveSet(z, active);
+    computeActiveSet(zpdal, active_pdal);
+  }
+
+private:
+  /// Apply \f$P\f$ (or \f$I - P\f$ if @p normal is true) in the boundary
+  /// region, one column at a time so as not to allocate memory.
+  static void applyBoundaryJacobian(const ConstVectorRef &z, const Scalar r,
+                                    MatrixRef Jout, const bool normal) {
+    const long n = z.size() - 1;
+    const Scalar half = 0.5;
+    const Scalar s = z(0) / r;
+    const Scalar sign = normal ? -1. : 1.;
+    auto x = z.tail(n);
+    for (long c = 0; c < Jout.cols(); c++) {
+      auto Jx = Jout.col(c).tail(n);
+      // w = Jx^T u
+      const Scalar w = x.dot(Jx) / r;
+      const Scalar j0 = Jout(0, c);
+      Jx *= half * (1. + sign * s);
+      Jx += (sign * half / r * (j0 - s * w)) * x;
+      Jout(0, c) = half * (j0 + sign * w);
+    }
+  }
+};
+
+#ifdef PROXSUITE_NLP_ENABLE_TEMPLATE_INSTANTIATION
+extern template struct PROXSUITE_NLP_EXPLICIT_INSTANTIATION_DECLARATION_DLLAPI
+    SecondOrderConeTpl<context::Scalar>;
+#endif
+
+} // namespace nlp
+} // namespace proxsuite
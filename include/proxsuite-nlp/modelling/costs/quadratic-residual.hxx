@@ -51,8 +51,7 @@ void QuadraticResidualCostTpl<Scalar>::computeHessian(const ConstVectorRef &x,
   tmp_w_err += slope_;
 
   if (!gauss_newton_) {
-    residual_->vectorHessianProduct(x, tmp_w_err, H);
-    out = H;
+    residual_->vectorHessianProduct(x, tmp_w_err, out);
   } else {
     out.setZero();
   }
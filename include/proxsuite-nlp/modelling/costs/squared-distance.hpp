@@ -13,6 +13,11 @@ namespace nlp {
  *            provides a convenient constructor. It uses
  * ManifoldDifferenceToPoint under the hood as the input residual for the
  * parent. This struct also exposes a method to update the target point.
+ *
+ * The derivatives exploit the structure of the Jacobians of the space (see
+ * JacobianStructure): on vector spaces, the residual Jacobian is the identity,
+ * and with block-diagonal Jacobians the products only involve the diagonal
+ * blocks.
  */
 template <typename _Scalar>
 struct QuadraticDistanceCostTpl : QuadraticResidualCostTpl<_Scalar> {
@@ -21,13 +26,21 @@ struct QuadraticDistanceCostTpl : QuadraticResidualCostTpl<_Scalar> {
   using StateResidual = ManifoldDifferenceToPoint<Scalar>;
   using Manifold = ManifoldAbstractTpl<Scalar>;
   using Base = QuadraticResidualCostTpl<Scalar>;
+  using Base::computeGradient;
+  using Base::computeHessian;
+  using Base::gauss_newton_;
   using Base::residual_;
+  using Base::slope_;
   using Base::weights_;
 
   QuadraticDistanceCostTpl(const polymorphic<Manifold> &space,
                            const ConstVectorRef &target,
                            const ConstMatrixRef &weights)
-      : Base(std::make_shared<StateResidual>(space, target), weights) {}
+      : Base(std::make_shared<StateResidual>(space, target), weights),
+        structure_(space->jacobianStructure()), block_offsets_{0} {
+    for (int n : space->jacobianBlocks())
+      block_offsets_.push_back(block_offsets_.back() + n);
+  }
 
   QuadraticDistanceCostTpl(const polymorphic<Manifold> &space,
                            const ConstVectorRef &target)
@@ -44,11 +57,28 @@ struct QuadraticDistanceCostTpl : QuadraticResidualCostTpl<_Scalar> {
   void updateTarget(const ConstVectorRef &x) {
     static_cast<StateResidual *>(residual_.get())->target_ = x;
   }
+
+  void computeGradient(const ConstVectorRef &x, VectorRef out) const;
+
+  void computeHessian(const ConstVectorRef &x, MatrixRef out) const;
+
+protected:
+  using Base::err;
+  using Base::H;
+  using Base::Jres;
+  using Base::JtW;
+  using Base::tmp_w_err;
+
+  JacobianStructure structure_;
+  /// Offsets of the diagonal blocks of the residual Jacobian.
+  std::vector<int> block_offsets_;
 };
 
 } // namespace nlp
 } // namespace proxsuite
 
+#include "proxsuite-nlp/modelling/costs/squared-distance.hxx"
+
 #ifdef PROXSUITE_NLP_ENABLE_TEMPLATE_INSTANTIATION
 #include "proxsuite-nlp/modelling/costs/squared-distance.txx"
 #endif
@@ -0,0 +1,68 @@
+#pragma once
+
+#include "./squared-distance.hpp"
+
+namespace proxsuite {
+namespace nlp {
+
+template <typename Scalar>
+void QuadraticDistanceCostTpl<Scalar>::computeGradient(const ConstVectorRef &x,
+                                                       VectorRef out) const {
+  switch (structure_) {
+  case JacobianStructure::IDENTITY:
+    out.noalias() = weights_ * err;
+    out += slope_;
+    break;
+  case JacobianStructure::BLOCK_DIAGONAL:
+    residual_->computeJacobian(x, Jres);
+    tmp_w_err.noalias() = weights_ * err;
+    tmp_w_err += slope_;
+    for (std::size_t i = 0; i + 1 < block_offsets_.size(); i++) {
+      const int c = block_offsets_[i], n = block_offsets_[i + 1] - c;
+      out.segment(c, n).noalias() =
+          Jres.block(c, c, n, n).transpose() * tmp_w_err.segment(c, n);
+    }
+    break;
+  default:
+    Base::computeGradient(x, out);
+    break;
+  }
+}
+
+template <typename Scalar>
+void QuadraticDistanceCostTpl<Scalar>::computeHessian(const ConstVectorRef &x,
+                                                      MatrixRef out) const {
+  switch (structure_) {
+  case JacobianStructure::IDENTITY:
+    // the residual is affine, with an identity Jacobian
+    out = weights_;
+    break;
+  case JacobianStructure::BLOCK_DIAGONAL:
+    if (!gauss_newton_) {
+      tmp_w_err.noalias() = weights_ * err;
+      tmp_w_err += slope_;
+      residual_->vectorHessianProduct(x, tmp_w_err, out);
+    } else {
+      out.setZero();
+    }
+    residual_->computeJacobian(x, Jres);
+    // J^T W J, with the diagonal blocks of J on either side of W
+    for (std::size_t i = 0; i + 1 < block_offsets_.size(); i++) {
+      const int c = block_offsets_[i], n = block_offsets_[i + 1] - c;
+      JtW.middleRows(c, n).noalias() =
+          Jres.block(c, c, n, n).transpose() * weights_.middleRows(c, n);
+    }
+    for (std::size_t i = 0; i + 1 < block_offsets_.size(); i++) {
+      const int c = block_offsets_[i], n = block_offsets_[i + 1] - c;
+      out.middleCols(c, n).noalias() +=
+          JtW.middleCols(c, n) * Jres.block(c, c, n, n);
+    }
+    break;
+  default:
+    Base::computeHessian(x, out);
+    break;
+  }
+}
+
+} // namespace nlp
+} // namespace proxsuite
@@ -22,7 +22,9 @@ template <typename _Scalar> struct LinearFunctionTpl : C2FunctionTpl<_Scalar> {
   VectorXs b;
 
   LinearFunctionTpl(const ConstMatrixRef &A, const ConstVectorRef &b)
-      : Base((int)A.cols(), (int)A.cols(), (int)A.rows()), mat(A), b(b) {}
+      : Base((int)A.cols(), (int)A.cols(), (int)A.rows()), mat(A), b(b) {
+    this->thread_safe_ = true;
+  }
 
   LinearFunctionTpl(const ConstMatrixRef &A)
       : LinearFunctionTpl(A, VectorXs::Zero(A.rows())) {}
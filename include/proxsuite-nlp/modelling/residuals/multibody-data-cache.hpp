@@ -0,0 +1,120 @@
+/// @file multibody-data-cache.hpp
+/// @copyright Copyright (C) 2026 LAAS-CNRS, INRIA
+/// @brief  Pinocchio data shared by the multibody residuals of a problem.
+#pragma once
+
+#include "proxsuite-nlp/evaluation-cache.hpp"
+#include "proxsuite-nlp/fwd.hpp"
+
+#include <pinocchio/multibody/model.hpp>
+#include <pinocchio/multibody/data.hpp>
+#include <pinocchio/algorithm/kinematics.hpp>
+#include <pinocchio/algorithm/frames.hpp>
+#include <pinocchio/algorithm/jacobian.hpp>
+#include <pinocchio/algorithm/center-of-mass.hpp>
+
+namespace proxsuite {
+namespace nlp {
+
+/// @brief  A pinocchio::DataTpl object holding the forward kinematics of a
+/// model at the last evaluation point, shared by the residuals of a problem.
+/// @details The residuals request the kinematics, or the joint Jacobians, at
+/// their input configuration: they are only recomputed if the configuration
+/// differs from the cached one, or after invalidate(). Register the cache with
+/// ProblemTpl::addCache() so that the solver invalidates it at each new point.
+///
+/// The input of kinematics() and jacobians() may be a configuration or a
+/// phase space point \f$(q, v)\f$, of which only \f$q\f$ is read.
+template <typename _Scalar, int _Options = 0>
+struct MultibodyDataCacheTpl : EvaluationCacheBase {
+  using Scalar = _Scalar;
+  static constexpr int Options = _Options;
+  PROXSUITE_NLP_DYNAMIC_TYPEDEFS(Scalar);
+  using ModelType = pinocchio::ModelTpl<Scalar, Options>;
+  using DataType = pinocchio::DataTpl<Scalar, Options>;
+
+  MultibodyDataCacheTpl(const ModelType &model)
+      : model_(model), data_(model_), q_(model_.nq) {
+    q_.setZero();
+  }
+
+  const ModelType &getModel() const { return model_; }
+
+  /// @brief Joint and frame placements at the configuration @p x.
+  const DataType &kinematics(const ConstVectorRef &x) {
+    const auto q = x.head(model_.nq);
+    if (!kinematics_valid_ || (q != q_)) {
+      q_ = q;
+      pinocchio::forwardKinematics(model_, data_, q_);
+      pinocchio::updateFramePlacements(model_, data_);
+      kinematics_valid_ = true;
+      jacobians_valid_ = false;
+      com_valid_ = false;
+      com_jacobian_valid_ = false;
+      num_kinematics_++;
+    }
+    return data_;
+  }
+
+  /// @brief Placements, along with the joint Jacobians (see
+  /// pinocchio::computeJointJacobians()) at the configuration @p x.
+  const DataType &jacobians(const ConstVectorRef &x) {
+    kinematics(x);
+    if (!jacobians_valid_) {
+      pinocchio::computeJointJacobians(model_, data_, q_);
+      jacobians_valid_ = true;
+      num_jacobians_++;
+    }
+    return data_;
+  }
+
+  /// @brief Placements, along with the center of mass `data.com[0]` at the
+  /// configuration @p x.
+  const DataType &centerOfMass(const ConstVectorRef &x) {
+    kinematics(x);
+    if (!com_valid_) {
+      pinocchio::centerOfMass(model_, data_, pinocchio::POSITION, false);
+      com_valid_ = true;
+    }
+    return data_;
+  }
+
+  /// @brief Placements, along with the center of mass and its Jacobian
+  /// `data.Jcom` at the configuration @p x.
+  const DataType &centerOfMassJacobian(const ConstVectorRef &x) {
+    kinematics(x);
+    if (!com_jacobian_valid_) {
+      pinocchio::jacobianCenterOfMass(model_, data_, false);
+      com_valid_ = true;
+      com_jacobian_valid_ = true;
+    }
+    return data_;
+  }
+
+  void invalidate() override {
+    kinematics_valid_ = false;
+    jacobians_valid_ = false;
+    com_valid_ = false;
+    com_jacobian_valid_ = false;
+  }
+
+  /// Number of forward kinematics passes run by the cache.
+  std::size_t numKinematicsPasses() const { return num_kinematics_; }
+  /// Number of joint Jacobian passes run by the cache.
+  std::size_t numJacobiansPasses() const { return num_jacobians_; }
+
+protected:
+  ModelType model_;
+  DataType data_;
+  /// Configuration of the cached quantities.
+  VectorXs q_;
+  bool kinematics_valid_ = false;
+  bool jacobians_valid_ = false;
+  bool com_valid_ = false;
+  bool com_jacobian_valid_ = false;
+  std::size_t num_kinematics_ = 0;
+  std::size_t num_jacobians_ = 0;
+};
+
+} // namespace nlp
+} // namespace proxsuite
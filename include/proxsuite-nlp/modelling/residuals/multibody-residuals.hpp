@@ -0,0 +1,159 @@
+/// @file multibody-residuals.hpp
+/// @copyright Copyright (C) 2026 LAAS-CNRS, INRIA
+/// @brief  Frame and center of mass residuals of a multibody system.
+#pragma once
+
+#include "proxsuite-nlp/function-base.hpp"
+#include "proxsuite-nlp/modelling/spaces/multibody.hpp"
+#include "proxsuite-nlp/modelling/residuals/multibody-data-cache.hpp"
+
+#include <pinocchio/spatial/se3.hpp>
+
+namespace proxsuite {
+namespace nlp {
+
+/// @brief  Base class for the residuals of the configuration \f$q\f$ of a
+/// multibody, defined on MultibodyConfiguration or on MultibodyPhaseSpace.
+/// @details The kinematics are read from a MultibodyDataCacheTpl, which may be
+/// shared with the other functions of the problem (see ProblemTpl::addCache()).
+/// By default, each residual holds its own cache. On the phase space, only the
+/// first \f$n_v\f$ columns of the Jacobian (those w.r.t. \f$q\f$) are nonzero,
+/// which is declared through C1FunctionTpl::setJacobianColumns().
+///
+/// These residuals are never thread-safe (see isThreadSafe()), even when their
+/// cache is not registered with the problem: the solver then evaluates the
+/// linesearch trials one after the other.
+template <typename _Scalar>
+struct MultibodyResidualBaseTpl : C2FunctionTpl<_Scalar> {
+  using Scalar = _Scalar;
+  PROXSUITE_NLP_DYNAMIC_TYPEDEFS(Scalar);
+  using Base = C2FunctionTpl<Scalar>;
+  using ConfigSpace = MultibodyConfiguration<Scalar>;
+  using PhaseSpace = MultibodyPhaseSpace<Scalar>;
+  using DataCache = MultibodyDataCacheTpl<Scalar>;
+  using ModelType = typename DataCache::ModelType;
+  using DataType = typename DataCache::DataType;
+
+  const ModelType &getModel() const { return cache_->getModel(); }
+  const shared_ptr<DataCache> &getCache() const { return cache_; }
+
+  /// The pinocchio data of the cache and the Jacobian buffers are written by
+  /// every evaluation, whatever setThreadSafe() was given.
+  bool isThreadSafe() const override { return false; }
+
+protected:
+  MultibodyResidualBaseTpl(const ManifoldAbstractTpl<Scalar> &space,
+                           const ModelType &model, const int nr,
+                           shared_ptr<DataCache> cache);
+
+  void checkFrameIndex(pinocchio::FrameIndex frame_id) const;
+
+  /// Jacobian of the frame @p frame_id, expressed in the local frame, from the
+  /// joint Jacobians of @p data.
+  void computeLocalFrameJacobian(const DataType &data,
+                                 pinocchio::FrameIndex frame_id,
+                                 MatrixRef fJf) const;
+
+  /// Set the (structurally zero) velocity columns of the Jacobian.
+  void setVelocityColumnsZero(MatrixRef Jout) const;
+
+  shared_ptr<DataCache> cache_;
+  /// Buffer for the joint Jacobian.
+  mutable Matrix6Xs jJj_;
+};
+
+/// @brief  Placement error \f$\log(\bar{M}^{-1}\,{}^oM_f(q))\in\mathbb{R}^6\f$
+/// between a frame and its target placement \f$\bar{M}\f$.
+template <typename _Scalar>
+struct FramePlacementResidualTpl : MultibodyResidualBaseTpl<_Scalar> {
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+  using Scalar = _Scalar;
+  PROXSUITE_NLP_DYNAMIC_TYPEDEFS(Scalar);
+  using Base = MultibodyResidualBaseTpl<Scalar>;
+  using typename Base::ConfigSpace;
+  using typename Base::DataCache;
+  using typename Base::DataType;
+  using typename Base::PhaseSpace;
+  using SE3 = pinocchio::SE3Tpl<Scalar>;
+  using Base::computeJacobian;
+
+  pinocchio::FrameIndex frame_id_;
+  SE3 target_;
+
+  FramePlacementResidualTpl(const ConfigSpace &space,
+                            pinocchio::FrameIndex frame_id, const SE3 &target,
+                            shared_ptr<DataCache> cache = nullptr);
+  FramePlacementResidualTpl(const PhaseSpace &space,
+                            pinocchio::FrameIndex frame_id, const SE3 &target,
+                            shared_ptr<DataCache> cache = nullptr);
+
+  VectorXs operator()(const ConstVectorRef &x) const override;
+  void computeJacobian(const ConstVectorRef &x, MatrixRef Jout) const override;
+
+protected:
+  mutable Matrix6Xs fJf_;
+  mutable Matrix6s Jlog_;
+};
+
+/// @brief  Position error \f${}^op_f(q) - \bar{p}\f$ of the origin of a frame.
+template <typename _Scalar>
+struct FrameTranslationResidualTpl : MultibodyResidualBaseTpl<_Scalar> {
+  using Scalar = _Scalar;
+  PROXSUITE_NLP_DYNAMIC_TYPEDEFS(Scalar);
+  using Base = MultibodyResidualBaseTpl<Scalar>;
+  using typename Base::ConfigSpace;
+  using typename Base::DataCache;
+  using typename Base::DataType;
+  using typename Base::PhaseSpace;
+  using Base::computeJacobian;
+
+  pinocchio::FrameIndex frame_id_;
+  Vector3s target_;
+
+  FrameTranslationResidualTpl(const ConfigSpace &space,
+                              pinocchio::FrameIndex frame_id,
+                              const Vector3s &target,
+                              shared_ptr<DataCache> cache = nullptr);
+  FrameTranslationResidualTpl(const PhaseSpace &space,
+                              pinocchio::FrameIndex frame_id,
+                              const Vector3s &target,
+                              shared_ptr<DataCache> cache = nullptr);
+
+  VectorXs operator()(const ConstVectorRef &x) const override;
+  void computeJacobian(const ConstVectorRef &x, MatrixRef Jout) const override;
+
+protected:
+  mutable Matrix6Xs fJf_;
+};
+
+/// @brief  Position error \f$c(q) - \bar{c}\f$ of the center of mass.
+template <typename _Scalar>
+struct CenterOfMassResidualTpl : MultibodyResidualBaseTpl<_Scalar> {
+  using Scalar = _Scalar;
+  PROXSUITE_NLP_DYNAMIC_TYPEDEFS(Scalar);
+  using Base = MultibodyResidualBaseTpl<Scalar>;
+  using typename Base::ConfigSpace;
+  using typename Base::DataCache;
+  using typename Base::DataType;
+  using typename Base::PhaseSpace;
+  using Base::computeJacobian;
+
+  Vector3s target_;
+
+  CenterOfMassResidualTpl(const ConfigSpace &space, const Vector3s &target,
+                          shared_ptr<DataCache> cache = nullptr);
+  CenterOfMassResidualTpl(const PhaseSpace &space, const Vector3s &target,
+                          shared_ptr<DataCache> cache = nullptr);
+
+  VectorXs operator()(const ConstVectorRef &x) const override;
+  void computeJacobian(const ConstVectorRef &x, MatrixRef Jout) const override;
+};
+
+} // namespace nlp
+} // namespace proxsuite
+
+#include "proxsuite-nlp/modelling/residuals/multibody-residuals.hxx"
+
+#ifdef PROXSUITE_NLP_ENABLE_TEMPLATE_INSTANTIATION
+#include "proxsuite-nlp/modelling/residuals/multibody-residuals.txx"
+#endif
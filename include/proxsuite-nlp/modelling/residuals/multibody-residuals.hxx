@@ -0,0 +1,166 @@
+#pragma once
+
+#include "proxsuite-nlp/modelling/residuals/multibody-residuals.hpp"
+
+#include <pinocchio/spatial/explog.hpp>
+
+namespace proxsuite {
+namespace nlp {
+
+template <typename Scalar>
+MultibodyResidualBaseTpl<Scalar>::MultibodyResidualBaseTpl(
+    const ManifoldAbstractTpl<Scalar> &space, const ModelType &model,
+    const int nr, shared_ptr<DataCache> cache)
+    : Base(space, nr),
+      cache_(cache ? std::move(cache) : std::make_shared<DataCache>(model)),
+      jJj_(6, model.nv) {
+  const ModelType &cache_model = cache_->getModel();
+  if ((cache_model.nq != model.nq) || (cache_model.nv != model.nv))
+    PROXSUITE_NLP_RUNTIME_ERROR(
+        "The data cache was built from a model of different dimensions.");
+  // only the columns of the supporting joints are written
+  jJj_.setZero();
+  if (this->ndx() > model.nv)
+    this->setJacobianColumns(0, model.nv);
+}
+
+template <typename Scalar>
+void MultibodyResidualBaseTpl<Scalar>::checkFrameIndex(
+    pinocchio::FrameIndex frame_id) const {
+  if (frame_id >= getModel().frames.size())
+    PROXSUITE_NLP_RUNTIME_ERROR(
+        fmt::format("Invalid frame index {:d} (model has {:d} frames).",
+                    frame_id, getModel().frames.size()));
+}
+
+template <typename Scalar>
+void MultibodyResidualBaseTpl<Scalar>::computeLocalFrameJacobian(
+    const DataType &data, pinocchio::FrameIndex frame_id,
+    MatrixRef fJf) const {
+  const ModelType &model = getModel();
+  const auto &frame = model.frames[frame_id];
+  pinocchio::getJointJacobian(model, data, frame.parentJoint, pinocchio::LOCAL,
+                              jJj_);
+  fJf.noalias() = frame.placement.toActionMatrixInverse() * jJj_;
+}
+
+template <typename Scalar>
+void MultibodyResidualBaseTpl<Scalar>::setVelocityColumnsZero(
+    MatrixRef Jout) const {
+  const int nv = getModel().nv;
+  Jout.rightCols(this->ndx() - nv).setZero();
+}
+
+/* FramePlacementResidualTpl */
+
+template <typename Scalar>
+FramePlacementResidualTpl<Scalar>::FramePlacementResidualTpl(
+    const ConfigSpace &space, pinocchio::FrameIndex frame_id,
+    const SE3 &target, shared_ptr<DataCache> cache)
+    : Base(space, space.getModel(), 6, cache), frame_id_(frame_id),
+      target_(target), fJf_(6, space.getModel().nv) {
+  this->checkFrameIndex(frame_id_);
+  fJf_.setZero();
+  Jlog_.setZero();
+}
+
+template <typename Scalar>
+FramePlacementResidualTpl<Scalar>::FramePlacementResidualTpl(
+    const PhaseSpace &space, pinocchio::FrameIndex frame_id,
+    const SE3 &target, shared_ptr<DataCache> cache)
+    : Base(space, space.getModel(), 6, cache), frame_id_(frame_id),
+      target_(target), fJf_(6, space.getModel().nv) {
+  this->checkFrameIndex(frame_id_);
+  fJf_.setZero();
+  Jlog_.setZero();
+}
+
+template <typename Scalar>
+auto FramePlacementResidualTpl<Scalar>::operator()(
+    const ConstVectorRef &x) const -> VectorXs {
+  const DataType &data = this->cache_->kinematics(x);
+  return pinocchio::log6(target_.actInv(data.oMf[frame_id_])).toVector();
+}
+
+template <typename Scalar>
+void FramePlacementResidualTpl<Scalar>::computeJacobian(
+    const ConstVectorRef &x, MatrixRef Jout) const {
+  const DataType &data = this->cache_->jacobians(x);
+  this->computeLocalFrameJacobian(data, frame_id_, fJf_);
+  pinocchio::Jlog6(target_.actInv(data.oMf[frame_id_]), Jlog_);
+  const int nv = this->getModel().nv;
+  Jout.leftCols(nv).noalias() = Jlog_ * fJf_;
+  this->setVelocityColumnsZero(Jout);
+}
+
+/* FrameTranslationResidualTpl */
+
+template <typename Scalar>
+FrameTranslationResidualTpl<Scalar>::FrameTranslationResidualTpl(
+    const ConfigSpace &space, pinocchio::FrameIndex frame_id,
+    const Vector3s &target, shared_ptr<DataCache> cache)
+    : Base(space, space.getModel(), 3, cache), frame_id_(frame_id),
+      target_(target), fJf_(6, space.getModel().nv) {
+  this->checkFrameIndex(frame_id_);
+  fJf_.setZero();
+}
+
+template <typename Scalar>
+FrameTranslationResidualTpl<Scalar>::FrameTranslationResidualTpl(
+    const PhaseSpace &space, pinocchio::FrameIndex frame_id,
+    const Vector3s &target, shared_ptr<DataCache> cache)
+    : Base(space, space.getModel(), 3, cache), frame_id_(frame_id),
+      target_(target), fJf_(6, space.getModel().nv) {
+  this->checkFrameIndex(frame_id_);
+  fJf_.setZero();
+}
+
+template <typename Scalar>
+auto FrameTranslationResidualTpl<Scalar>::operator()(
+    const ConstVectorRef &x) const -> VectorXs {
+  const DataType &data = this->cache_->kinematics(x);
+  return data.oMf[frame_id_].translation() - target_;
+}
+
+template <typename Scalar>
+void FrameTranslationResidualTpl<Scalar>::computeJacobian(
+    const ConstVectorRef &x, MatrixRef Jout) const {
+  const DataType &data = this->cache_->jacobians(x);
+  this->computeLocalFrameJacobian(data, frame_id_, fJf_);
+  // linear velocity of the frame origin, expressed in the world frame
+  const int nv = this->getModel().nv;
+  Jout.leftCols(nv).noalias() =
+      data.oMf[frame_id_].rotation() * fJf_.template topRows<3>();
+  this->setVelocityColumnsZero(Jout);
+}
+
+/* CenterOfMassResidualTpl */
+
+template <typename Scalar>
+CenterOfMassResidualTpl<Scalar>::CenterOfMassResidualTpl(
+    const ConfigSpace &space, const Vector3s &target,
+    shared_ptr<DataCache> cache)
+    : Base(space, space.getModel(), 3, cache), target_(target) {}
+
+template <typename Scalar>
+CenterOfMassResidualTpl<Scalar>::CenterOfMassResidualTpl(
+    const PhaseSpace &space, const Vector3s &target,
+    shared_ptr<DataCache> cache)
+    : Base(space, space.getModel(), 3, cache), target_(target) {}
+
+template <typename Scalar>
+auto CenterOfMassResidualTpl<Scalar>::operator()(
+    const ConstVectorRef &x) const -> VectorXs {
+  return this->cache_->centerOfMass(x).com[0] - target_;
+}
+
+template <typename Scalar>
+void CenterOfMassResidualTpl<Scalar>::computeJacobian(
+    const ConstVectorRef &x, MatrixRef Jout) const {
+  const int nv = this->getModel().nv;
+  Jout.leftCols(nv) = this->cache_->centerOfMassJacobian(x).Jcom;
+  this->setVelocityColumnsZero(Jout);
+}
+
+} // namespace nlp
+} // namespace proxsuite
@@ -0,0 +1,19 @@
+#pragma once
+
+#include "proxsuite-nlp/context.hpp"
+#include "proxsuite-nlp/modelling/residuals/multibody-residuals.hpp"
+
+namespace proxsuite {
+namespace nlp {
+
+extern template struct PROXSUITE_NLP_EXPLICIT_INSTANTIATION_DECLARATION_DLLAPI
+    MultibodyResidualBaseTpl<context::Scalar>;
+extern template struct PROXSUITE_NLP_EXPLICIT_INSTANTIATION_DECLARATION_DLLAPI
+    FramePlacementResidualTpl<context::Scalar>;
+extern template struct PROXSUITE_NLP_EXPLICIT_INSTANTIATION_DECLARATION_DLLAPI
+    FrameTranslationResidualTpl<context::Scalar>;
+extern template struct PROXSUITE_NLP_EXPLICIT_INSTANTIATION_DECLARATION_DLLAPI
+    CenterOfMassResidualTpl<context::Scalar>;
+
+} // namespace nlp
+} // namespace proxsuite
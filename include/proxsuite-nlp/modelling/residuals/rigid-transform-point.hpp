@@ -37,6 +37,26 @@ struct RigidTransformationPointActionTpl : C2FunctionTpl<Scalar> {
     Jout.template rightCols<3>().noalias() = -q.matrix() * skew_point_;
   }
 
+  /// @details With \f$\mu = R^\top v\f$, the second-order term of
+  /// \f$v^\top(M\exp(\xi)\cdot p)\f$ in the twist \f$\xi = (\nu,
+  /// \omega)\f$ is \f$\frac12\mu^\top(\omega\times(\omega\times p +
+  /// \nu))\f$.
+  void vectorHessianProduct(const ConstVectorRef &x, const ConstVectorRef &v,
+                            MatrixRef Hout) const override {
+    assert(Hout.rows() == 6 && Hout.cols() == 6);
+    QuatConstMap q(x.template tail<4>().data());
+    const Vector3s mu = q.matrix().transpose() * v;
+    const Matrix33s skew_mu = pin::skew(mu);
+
+    Hout.template topLeftCorner<3, 3>().setZero();
+    Hout.template topRightCorner<3, 3>() = Scalar(0.5) * skew_mu;
+    Hout.template bottomLeftCorner<3, 3>() = Scalar(-0.5) * skew_mu;
+    auto Hww = Hout.template bottomRightCorner<3, 3>();
+    Hww.noalias() = Scalar(0.5) * (mu * point_.transpose());
+    Hww.noalias() += Scalar(0.5) * (point_ * mu.transpose());
+    Hww.diagonal().array() -= mu.dot(point_);
+  }
+
   Eigen::Ref<const Matrix33s> skew_point() const { return skew_point_; }
 
 private:
@@ -47,5 +67,5 @@ private:
 } // namespace proxsuite
 
 #ifdef PROXSUITE_NLP_ENABLE_TEMPLATE_INSTANTIATION
-#include "proxsuite-nlp/modelling/residuals/rigid-transform-point.hpp"
+#include "proxsuite-nlp/modelling/residuals/rigid-transform-point.txx"
 #endif
@@ -2,7 +2,7 @@
 
 #include "proxsuite-nlp/config.hpp"
 #include "proxsuite-nlp/context.hpp"
-#include "proxsuite-nlp/modelling/residual/rigid-transform-point.hpp"
+#include "proxsuite-nlp/modelling/residuals/rigid-transform-point.hpp"
 
 namespace proxsuite {
 namespace nlp {
@@ -8,6 +8,11 @@
 #include "proxsuite-nlp/manifold-base.hpp"
 #include "proxsuite-nlp/third-party/polymorphic_cxx14.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
 namespace proxsuite {
 namespace nlp {
 
@@ -33,11 +38,21 @@ public:
   ManifoldDifferenceToPoint(const polymorphic<Manifold> &space,
                             const ConstVectorRef &target)
       : Base(space->nx(), space->ndx(), space->ndx()), target_(target),
-        space_(space) {
+        space_(space), structure_(space->jacobianStructure()),
+        block_offsets_{0}, max_block_size_(0), dx_(space->ndx()),
+        x_plus_(space->nx()), x_minus_(space->nx()),
+        J_plus_(space->ndx(), space->ndx()),
+        J_minus_(space->ndx(), space->ndx()) {
     if (!space->isNormalized(target_)) {
       PROXSUITE_NLP_RUNTIME_ERROR(
           "Target parameter is not a valid element of the manifold.");
     }
+    for (int n : space->jacobianBlocks()) {
+      block_offsets_.push_back(block_offsets_.back() + n);
+      max_block_size_ = std::max(max_block_size_, n);
+    }
+    J_plus_.setZero();
+    J_minus_.setZero();
   }
 
   VectorXs operator()(const ConstVectorRef &x) const {
@@ -47,6 +62,64 @@ public:
   void computeJacobian(const ConstVectorRef &x, MatrixRef Jout) const {
     space_->Jdifference(target_, x, Jout, 1);
   }
+
+  /// @details The residual is affine on vector spaces, where this is zero.
+  /// Otherwise, ManifoldAbstractTpl does not provide second-order derivatives
+  /// of the difference. On block-diagonal structures, the product is obtained
+  /// from central differences of the Jacobian: since the Hessian has the same
+  /// diagonal blocks as the Jacobian (see JacobianStructure), the same
+  /// coordinate of every block is perturbed at once, which takes twice the
+  /// largest block size Jacobian evaluations instead of twice the tangent
+  /// space dimension. On dense structures, this would save nothing over
+  /// finite_difference_wrapper, to be used for this function if the
+  /// second-order derivatives are needed: the product is then left at zero,
+  /// as in C2FunctionTpl.
+  void vectorHessianProduct(const ConstVectorRef &x, const ConstVectorRef &v,
+                            MatrixRef Hout) const {
+    Hout.setZero();
+    if (structure_ != JacobianStructure::BLOCK_DIAGONAL)
+      return;
+    const Scalar eps = std::cbrt(std::numeric_limits<Scalar>::epsilon());
+    const std::size_t num_blocks = block_offsets_.size() - 1;
+    for (int k = 0; k < max_block_size_; k++) {
+      dx_.setZero();
+      for (std::size_t i = 0; i < num_blocks; i++) {
+        if (block_offsets_[i] + k < block_offsets_[i + 1])
+          dx_[block_offsets_[i] + k] = eps;
+      }
+      space_->integrate(x, dx_, x_plus_);
+      space_->integrate(x, -dx_, x_minus_);
+      space_->Jdifference(target_, x_plus_, J_plus_, 1);
+      space_->Jdifference(target_, x_minus_, J_minus_, 1);
+      for (std::size_t i = 0; i < num_blocks; i++) {
+        const int c = block_offsets_[i], n = block_offsets_[i + 1] - c;
+        if (k < n)
+          Hout.col(c + k).segment(c, n).noalias() =
+              (J_plus_.block(c, c, n, n) - J_minus_.block(c, c, n, n))
+                  .transpose() *
+              v.segment(c, n) / (2 * eps);
+      }
+    }
+    // The derivative of the Jacobian along the group is not symmetric; the
+    // Hessian of the residual composed with the retraction is its symmetric
+    // part.
+    for (std::size_t i = 0; i < num_blocks; i++) {
+      const int c = block_offsets_[i], n = block_offsets_[i + 1] - c;
+      auto Hb = Hout.block(c, c, n, n);
+      Hb = Scalar(0.5) * (Hb + Hb.transpose()).eval();
+    }
+  }
+
+protected:
+  JacobianStructure structure_;
+  /// Offsets of the diagonal blocks of the Jacobian.
+  std::vector<int> block_offsets_;
+  int max_block_size_;
+  mutable VectorXs dx_;
+  mutable VectorXs x_plus_;
+  mutable VectorXs x_minus_;
+  mutable MatrixXs J_plus_;
+  mutable MatrixXs J_minus_;
 };
 
 } // namespace nlp
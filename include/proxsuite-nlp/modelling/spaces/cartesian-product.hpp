@@ -3,7 +3,9 @@
 #include "proxsuite-nlp/manifold-base.hpp"
 #include "proxsuite-nlp/third-party/polymorphic_cxx14.hpp"
 
+#include <algorithm>
 #include <type_traits>
+#include <utility>
 
 namespace proxsuite {
 namespace nlp {
@@ -19,6 +21,49 @@ struct CartesianProductTpl : ManifoldAbstractTpl<_Scalar> {
 
 private:
   std::vector<polymorphic<Base>> m_components;
+  /// Offsets of the components in the points and tangent vectors, with the
+  /// total dimensions as last entries. They are cached when the components are
+  /// added, since the dimensions of a component never change.
+  std::vector<int> m_nx_offsets{0};
+  std::vector<int> m_ndx_offsets{0};
+  int m_max_ndx = 0;
+  /// Diagonal blocks of the Jacobians, refining those of the components.
+  std::vector<int> m_jac_blocks;
+  bool m_all_identity = true;
+
+  void pushOffsets(const Base &c) {
+    m_nx_offsets.push_back(m_nx_offsets.back() + c.nx());
+    m_ndx_offsets.push_back(m_ndx_offsets.back() + c.ndx());
+    m_max_ndx = std::max(m_max_ndx, c.ndx());
+    const JacobianStructure s = c.jacobianStructure();
+    m_all_identity = m_all_identity && (s == JacobianStructure::IDENTITY);
+    if (s == JacobianStructure::BLOCK_DIAGONAL) {
+      const std::vector<int> blocks = c.jacobianBlocks();
+      m_jac_blocks.insert(m_jac_blocks.end(), blocks.begin(), blocks.end());
+    } else if (c.ndx() > 0) {
+      m_jac_blocks.push_back(c.ndx());
+    }
+  }
+
+  void swap(CartesianProductTpl &other) noexcept {
+    using std::swap;
+    swap(m_components, other.m_components);
+    swap(m_nx_offsets, other.m_nx_offsets);
+    swap(m_ndx_offsets, other.m_ndx_offsets);
+    swap(m_max_ndx, other.m_max_ndx);
+    swap(m_jac_blocks, other.m_jac_blocks);
+    swap(m_all_identity, other.m_all_identity);
+  }
+
+  void computeOffsets() {
+    m_nx_offsets.assign(1, 0);
+    m_ndx_offsets.assign(1, 0);
+    m_max_ndx = 0;
+    m_jac_blocks.clear();
+    m_all_identity = true;
+    for (const auto &c : m_components)
+      pushOffsets(*c);
+  }
 
 public:
   const Base &getComponent(std::size_t i) const { return *m_components[i]; }
@@ -32,6 +77,7 @@ public:
         "Input type should either be derived from ManifoldAbstractTpl or be "
         "polymorphic<ManifoldAbstractTpl>.");
     m_components.emplace_back(c);
+    pushOffsets(*m_components.back());
   }
 
   inline void addComponent(const CartesianProductTpl &other) {
@@ -43,14 +89,24 @@ public:
   CartesianProductTpl() = default;
   CartesianProductTpl(const CartesianProductTpl &) = default;
   CartesianProductTpl &operator=(const CartesianProductTpl &) = default;
-  CartesianProductTpl(CartesianProductTpl &&) = default;
-  CartesianProductTpl &operator=(CartesianProductTpl &&) = default;
+  /// The moved-from product is left without components, and its offsets
+  /// remain valid.
+  CartesianProductTpl(CartesianProductTpl &&other) noexcept { swap(other); }
+  CartesianProductTpl &operator=(CartesianProductTpl &&other) noexcept {
+    CartesianProductTpl tmp(std::move(other));
+    swap(tmp);
+    return *this;
+  }
 
   CartesianProductTpl(const std::vector<polymorphic<Base>> &components)
-      : m_components(components) {}
+      : m_components(components) {
+    computeOffsets();
+  }
 
   CartesianProductTpl(std::initializer_list<polymorphic<Base>> components)
-      : m_components(components) {}
+      : m_components(components) {
+    computeOffsets();
+  }
 
   CartesianProductTpl(const polymorphic<Base> &left,
                       const polymorphic<Base> &right) {
@@ -58,22 +114,63 @@ public:
     addComponent(right);
   }
 
-  inline int nx() const {
-    int r = 0;
-    for (std::size_t i = 0; i < numComponents(); i++) {
-      r += m_components[i]->nx();
-    }
-    return r;
+  inline int nx() const { return m_nx_offsets.back(); }
+
+  inline int ndx() const { return m_ndx_offsets.back(); }
+
+  /// Offset of the @p i-th component in the points of the product.
+  inline int nxOffset(std::size_t i) const { return m_nx_offsets[i]; }
+
+  /// Offset of the @p i-th component in the tangent vectors of the product.
+  inline int ndxOffset(std::size_t i) const { return m_ndx_offsets[i]; }
+
+  /// Largest tangent dimension of the components.
+  inline int maxComponentNdx() const { return m_max_ndx; }
+
+  /// The Jacobians are block-diagonal, or the identity if all the components
+  /// are vector spaces.
+  JacobianStructure jacobianStructure() const {
+    if (m_all_identity)
+      return JacobianStructure::IDENTITY;
+    return m_jac_blocks.size() > 1 ? JacobianStructure::BLOCK_DIAGONAL
+                                   : JacobianStructure::DENSE;
   }
 
-  inline int ndx() const {
-    int r = 0;
-    for (std::size_t i = 0; i < numComponents(); i++) {
-      r += m_components[i]->ndx();
-    }
-    return r;
+  std::vector<int> jacobianBlocks() const { return m_jac_blocks; }
+
+  /// @name   Component views
+  /// Segments of points and tangent vectors of the product corresponding to
+  /// the @p i-th component. Unlike split(), these do not allocate.
+  /// \{
+
+  template <typename Point>
+  typename Point::ConstSegmentReturnType
+  getComponentPoint(const Point &x, std::size_t i) const {
+    return x.segment(m_nx_offsets[i], m_nx_offsets[i + 1] - m_nx_offsets[i]);
+  }
+
+  template <typename Point>
+  typename Point::SegmentReturnType
+  getComponentPointWrite(const Point &x, std::size_t i) const {
+    return PROXSUITE_NLP_EIGEN_CONST_CAST(Point, x)
+        .segment(m_nx_offsets[i], m_nx_offsets[i + 1] - m_nx_offsets[i]);
+  }
+
+  template <typename Tangent>
+  typename Tangent::ConstSegmentReturnType
+  getComponentTangent(const Tangent &v, std::size_t i) const {
+    return v.segment(m_ndx_offsets[i], m_ndx_offsets[i + 1] - m_ndx_offsets[i]);
+  }
+
+  template <typename Tangent>
+  typename Tangent::SegmentReturnType
+  getComponentTangentWrite(const Tangent &v, std::size_t i) const {
+    return PROXSUITE_NLP_EIGEN_CONST_CAST(Tangent, v)
+        .segment(m_ndx_offsets[i], m_ndx_offsets[i + 1] - m_ndx_offsets[i]);
   }
 
+  /// \}
+
   VectorXs neutral() const;
   VectorXs rand() const;
   bool isNormalized(const ConstVectorRef &x) const;
@@ -120,6 +217,30 @@ public:
 
   void Jdifference_impl(const ConstVectorRef &x0, const ConstVectorRef &x1,
                         MatrixRef Jout, int arg) const;
+
+  /// @name   Block-diagonal Jacobians
+  /// The Jacobians of integrate() and difference() are block-diagonal. These
+  /// variants only compute the diagonal blocks, stacked vertically in an
+  /// `ndx() x maxComponentNdx()` matrix: the block of the @p i-th component
+  /// lies in its rows (see ndxOffset()) and its first ndx columns.
+  /// \{
+
+  void Jintegrate_blocks(const ConstVectorRef &x, const ConstVectorRef &v,
+                         MatrixRef Jblocks, int arg) const;
+
+  void Jdifference_blocks(const ConstVectorRef &x0, const ConstVectorRef &x1,
+                          MatrixRef Jblocks, int arg) const;
+
+  /// \}
+
+  /// Batched integration: each component is applied once, to its block of
+  /// rows of all the points.
+  void integrate_batch_impl(const ConstMatrixRef &X, const ConstMatrixRef &V,
+                            MatrixRef Xout) const;
+
+  /// @copydoc integrate_batch_impl()
+  void difference_batch_impl(const ConstMatrixRef &X0, const ConstMatrixRef &X1,
+                             MatrixRef Vout) const;
 };
 
 template <typename T>
@@ -8,11 +8,8 @@ namespace nlp {
 template <typename Scalar>
 auto CartesianProductTpl<Scalar>::neutral() const -> VectorXs {
   VectorXs out(this->nx());
-  Eigen::Index c = 0;
   for (std::size_t i = 0; i < numComponents(); i++) {
-    const long n = m_components[i]->nx();
-    out.segment(c, n) = m_components[i]->neutral();
-    c += n;
+    getComponentPointWrite(out, i) = m_components[i]->neutral();
   }
   return out;
 }
@@ -20,23 +17,19 @@ auto CartesianProductTpl<Scalar>::neutral() const -> VectorXs {
 template <typename Scalar>
 auto CartesianProductTpl<Scalar>::rand() const -> VectorXs {
   VectorXs out(this->nx());
-  Eigen::Index c = 0;
   for (std::size_t i = 0; i < numComponents(); i++) {
-    const long n = m_components[i]->nx();
-    out.segment(c, n) = m_components[i]->rand();
-    c += n;
+    getComponentPointWrite(out, i) = m_components[i]->rand();
   }
   return out;
 }
 
 template <typename Scalar>
 bool CartesianProductTpl<Scalar>::isNormalized(const ConstVectorRef &x) const {
-  bool res = true;
-  auto xs = this->split(x);
   for (std::size_t i = 0; i < numComponents(); i++) {
-    res |= m_components[i]->isNormalized(xs[i]);
+    if (!m_components[i]->isNormalized(getComponentPoint(x, i)))
+      return false;
   }
-  return res;
+  return true;
 }
 
 template <typename Scalar>
@@ -44,11 +37,9 @@ template <class VectorType, class U>
 std::vector<U> CartesianProductTpl<Scalar>::split_impl(VectorType &x) const {
   PROXSUITE_NLP_DIM_CHECK(x, this->nx());
   std::vector<U> out;
-  Eigen::Index c = 0;
+  out.reserve(numComponents());
   for (std::size_t i = 0; i < numComponents(); i++) {
-    const long n = m_components[i]->nx();
-    out.push_back(x.segment(c, n));
-    c += n;
+    out.push_back(getComponentPointWrite(x, i));
   }
   return out;
 }
@@ -59,11 +50,9 @@ std::vector<U>
 CartesianProductTpl<Scalar>::split_vector_impl(VectorType &v) const {
   PROXSUITE_NLP_DIM_CHECK(v, this->ndx());
   std::vector<U> out;
-  Eigen::Index c = 0;
+  out.reserve(numComponents());
   for (std::size_t i = 0; i < numComponents(); i++) {
-    const long n = m_components[i]->ndx();
-    out.push_back(v.segment(c, n));
-    c += n;
+    out.push_back(getComponentTangentWrite(v, i));
   }
   return out;
 }
@@ -72,11 +61,8 @@ template <typename Scalar>
 auto CartesianProductTpl<Scalar>::merge(const std::vector<VectorXs> &xs) const
     -> VectorXs {
   VectorXs out(this->nx());
-  Eigen::Index c = 0;
   for (std::size_t i = 0; i < numComponents(); i++) {
-    const long n = m_components[i]->nx();
-    out.segment(c, n) = xs[i];
-    c += n;
+    getComponentPointWrite(out, i) = xs[i];
   }
   return out;
 }
@@ -85,11 +71,8 @@ template <typename Scalar>
 auto CartesianProductTpl<Scalar>::merge_vector(
     const std::vector<VectorXs> &vs) const -> VectorXs {
   VectorXs out(this->ndx());
-  Eigen::Index c = 0;
   for (std::size_t i = 0; i < numComponents(); i++) {
-    const long n = m_components[i]->ndx();
-    out.segment(c, n) = vs[i];
-    c += n;
+    getComponentTangentWrite(out, i) = vs[i];
   }
   return out;
 }
@@ -99,18 +82,10 @@ void CartesianProductTpl<Scalar>::integrate_impl(const ConstVectorRef &x,
                                                  const ConstVectorRef &v,
                                                  VectorRef out) const {
   assert(nx() == out.size());
-  Eigen::Index cq = 0, cv = 0;
   for (std::size_t i = 0; i < numComponents(); i++) {
-    const long nq = getComponent(i).nx();
-    const long nv = getComponent(i).ndx();
-    auto sx = x.segment(cq, nq);
-    auto sv = v.segment(cv, nv);
-
-    auto sout = out.segment(cq, nq);
-
-    getComponent(i).integrate(sx, sv, sout);
-    cq += nq;
-    cv += nv;
+    getComponent(i).integrate(getComponentPoint(x, i),
+                              getComponentTangent(v, i),
+                              getComponentPointWrite(out, i));
   }
 }
 
@@ -119,18 +94,10 @@ void CartesianProductTpl<Scalar>::difference_impl(const ConstVectorRef &x0,
                                                   const ConstVectorRef &x1,
                                                   VectorRef out) const {
   assert(ndx() == out.size());
-  Eigen::Index cq = 0, cv = 0;
   for (std::size_t i = 0; i < numComponents(); i++) {
-    const long nq = getComponent(i).nx();
-    const long nv = getComponent(i).ndx();
-    auto sx0 = x0.segment(cq, nq);
-    auto sx1 = x1.segment(cq, nq);
-
-    auto sout = out.segment(cv, nv);
-
-    getComponent(i).difference(sx0, sx1, sout);
-    cq += nq;
-    cv += nv;
+    getComponent(i).difference(getComponentPoint(x0, i),
+                               getComponentPoint(x1, i),
+                               getComponentTangentWrite(out, i));
   }
 }
 
@@ -140,19 +107,17 @@ void CartesianProductTpl<Scalar>::Jintegrate_impl(const ConstVectorRef &x,
                                                   MatrixRef Jout,
                                                   int arg) const {
   assert(ndx() == Jout.rows());
-  Jout.setZero();
-  Eigen::Index cq = 0, cv = 0;
+  // only the off-diagonal blocks are zeroed, the components write the others
+  const int n = ndx();
   for (std::size_t i = 0; i < numComponents(); i++) {
-    const long nq = getComponent(i).nx();
-    const long nv = getComponent(i).ndx();
-    auto sx = x.segment(cq, nq);
-    auto sv = v.segment(cv, nv);
-
-    auto sJout = Jout.block(cv, cv, nv, nv);
-
-    getComponent(i).Jintegrate(sx, sv, sJout, arg);
-    cq += nq;
-    cv += nv;
+    const int c0 = m_ndx_offsets[i];
+    const int c1 = m_ndx_offsets[i + 1];
+    auto rows = Jout.middleRows(c0, c1 - c0);
+    rows.leftCols(c0).setZero();
+    rows.rightCols(n - c1).setZero();
+    getComponent(i).Jintegrate(getComponentPoint(x, i),
+                               getComponentTangent(v, i),
+                               rows.middleCols(c0, c1 - c0), arg);
   }
 }
 
@@ -161,18 +126,11 @@ void CartesianProductTpl<Scalar>::JintegrateTransport(const ConstVectorRef &x,
                                                       const ConstVectorRef &v,
                                                       MatrixRef Jout,
                                                       int arg) const {
-  Eigen::Index cq = 0, cv = 0;
   for (std::size_t i = 0; i < numComponents(); i++) {
-    const long nq = m_components[i]->nx();
-    auto sx = x.segment(cq, nq);
-    cq += nq;
-
-    const long nv = m_components[i]->ndx();
-    auto sv = v.segment(cv, nv);
-    auto sJout = Jout.middleRows(cv, nv);
-    cv += nv;
-
-    getComponent(i).JintegrateTransport(sx, sv, sJout, arg);
+    const int c0 = m_ndx_offsets[i];
+    auto sJout = Jout.middleRows(c0, m_ndx_offsets[i + 1] - c0);
+    getComponent(i).JintegrateTransport(getComponentPoint(x, i),
+                                        getComponentTangent(v, i), sJout, arg);
   }
 }
 
@@ -182,19 +140,71 @@ void CartesianProductTpl<Scalar>::Jdifference_impl(const ConstVectorRef &x0,
                                                    MatrixRef Jout,
                                                    int arg) const {
   assert(ndx() == Jout.rows());
-  Jout.setZero();
-  Eigen::Index cq = 0, cv = 0;
+  // only the off-diagonal blocks are zeroed, the components write the others
+  const int n = ndx();
+  for (std::size_t i = 0; i < numComponents(); i++) {
+    const int c0 = m_ndx_offsets[i];
+    const int c1 = m_ndx_offsets[i + 1];
+    auto rows = Jout.middleRows(c0, c1 - c0);
+    rows.leftCols(c0).setZero();
+    rows.rightCols(n - c1).setZero();
+    getComponent(i).Jdifference(getComponentPoint(x0, i),
+                                getComponentPoint(x1, i),
+                                rows.middleCols(c0, c1 - c0), arg);
+  }
+}
+
+template <typename Scalar>
+void CartesianProductTpl<Scalar>::Jintegrate_blocks(const ConstVectorRef &x,
+                                                    const ConstVectorRef &v,
+                                                    MatrixRef Jblocks,
+                                                    int arg) const {
+  assert(ndx() == Jblocks.rows() && maxComponentNdx() <= Jblocks.cols());
   for (std::size_t i = 0; i < numComponents(); i++) {
-    const long nq = m_components[i]->nx();
-    auto sx0 = x0.segment(cq, nq);
-    auto sx1 = x1.segment(cq, nq);
-    cq += nq;
+    const int c0 = m_ndx_offsets[i];
+    const int nv = m_ndx_offsets[i + 1] - c0;
+    getComponent(i).Jintegrate(getComponentPoint(x, i),
+                               getComponentTangent(v, i),
+                               Jblocks.block(c0, 0, nv, nv), arg);
+  }
+}
 
-    const long nv = m_components[i]->ndx();
-    auto sJout = Jout.block(cv, cv, nv, nv);
-    cv += nv;
+template <typename Scalar>
+void CartesianProductTpl<Scalar>::Jdifference_blocks(const ConstVectorRef &x0,
+                                                     const ConstVectorRef &x1,
+                                                     MatrixRef Jblocks,
+                                                     int arg) const {
+  assert(ndx() == Jblocks.rows() && maxComponentNdx() <= Jblocks.cols());
+  for (std::size_t i = 0; i < numComponents(); i++) {
+    const int c0 = m_ndx_offsets[i];
+    const int nv = m_ndx_offsets[i + 1] - c0;
+    getComponent(i).Jdifference(getComponentPoint(x0, i),
+                                getComponentPoint(x1, i),
+                                Jblocks.block(c0, 0, nv, nv), arg);
+  }
+}
 
-    getComponent(i).Jdifference(sx0, sx1, sJout, arg);
+template <typename Scalar>
+void CartesianProductTpl<Scalar>::integrate_batch_impl(const ConstMatrixRef &X,
+                                                       const ConstMatrixRef &V,
+                                                       MatrixRef Xout) const {
+  for (std::size_t i = 0; i < numComponents(); i++) {
+    const int cq = m_nx_offsets[i], nq = m_nx_offsets[i + 1] - cq;
+    const int cv = m_ndx_offsets[i], nv = m_ndx_offsets[i + 1] - cv;
+    getComponent(i).integrate_batch(X.middleRows(cq, nq), V.middleRows(cv, nv),
+                                    Xout.middleRows(cq, nq));
+  }
+}
+
+template <typename Scalar>
+void CartesianProductTpl<Scalar>::difference_batch_impl(
+    const ConstMatrixRef &X0, const ConstMatrixRef &X1, MatrixRef Vout) const {
+  for (std::size_t i = 0; i < numComponents(); i++) {
+    const int cq = m_nx_offsets[i], nq = m_nx_offsets[i + 1] - cq;
+    const int cv = m_ndx_offsets[i], nv = m_ndx_offsets[i + 1] - cv;
+    getComponent(i).difference_batch(X0.middleRows(cq, nq),
+                                     X1.middleRows(cq, nq),
+                                     Vout.middleRows(cv, nv));
   }
 }
 
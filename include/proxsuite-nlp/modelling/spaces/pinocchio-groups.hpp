@@ -90,6 +90,47 @@ public:
     lg_.interpolate(x0, x1, u, out);
   }
 
+  /// \name Batched operations, calling the Lie group directly on each point.
+
+  void integrate_batch_impl(const ConstMatrixRef &X, const ConstMatrixRef &V,
+                            MatrixRef Xout) const {
+    for (Eigen::Index k = 0; k < X.cols(); k++) {
+      auto xout = Xout.col(k);
+      lg_.integrate(X.col(k), V.col(k), xout);
+    }
+  }
+
+  void difference_batch_impl(const ConstMatrixRef &X0, const ConstMatrixRef &X1,
+                             MatrixRef Vout) const {
+    for (Eigen::Index k = 0; k < X0.cols(); k++) {
+      auto vout = Vout.col(k);
+      lg_.difference(X0.col(k), X1.col(k), vout);
+    }
+  }
+
+  void Jintegrate_batch_impl(const ConstMatrixRef &X, const ConstMatrixRef &V,
+                             MatrixRef Jout, int arg) const {
+    const int n = ndx();
+    for (Eigen::Index k = 0; k < X.cols(); k++) {
+      auto J = Jout.middleCols(k * n, n);
+      if (arg == 0)
+        lg_.dIntegrate_dq(X.col(k), V.col(k), J);
+      else
+        lg_.dIntegrate_dv(X.col(k), V.col(k), J);
+    }
+  }
+
+  void Jdifference_batch_impl(const ConstMatrixRef &X0,
+                              const ConstMatrixRef &X1, MatrixRef Jout,
+                              int arg) const {
+    const int n = ndx();
+    const pin::ArgumentPosition pos = arg == 0 ? pin::ARG0 : pin::ARG1;
+    for (Eigen::Index k = 0; k < X0.cols(); k++) {
+      auto J = Jout.middleCols(k * n, n);
+      lg_.dDifference(X0.col(k), X1.col(k), J, pos);
+    }
+  }
+
   VectorXs neutral() const { return lg_.neutral(); }
 
   VectorXs rand() const { return lg_.random(); }
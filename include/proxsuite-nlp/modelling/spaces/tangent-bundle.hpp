@@ -39,6 +39,16 @@ public:
 
   const Base &getBaseSpace() const { return base_; }
 
+  /// The Jacobians are block-diagonal, the tangent component being the
+  /// identity.
+  JacobianStructure jacobianStructure() const {
+    return base_.jacobianStructure() == JacobianStructure::IDENTITY
+               ? JacobianStructure::IDENTITY
+               : JacobianStructure::BLOCK_DIAGONAL;
+  }
+
+  std::vector<int> jacobianBlocks() const;
+
   /// @name   Implementations of operators
 
   void integrate_impl(const ConstVectorRef &x, const ConstVectorRef &dx,
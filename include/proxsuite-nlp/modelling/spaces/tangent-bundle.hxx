@@ -19,6 +19,15 @@ template <class Base> auto TangentBundleTpl<Base>::rand() const -> VectorXs {
   return out;
 }
 
+template <class Base>
+std::vector<int> TangentBundleTpl<Base>::jacobianBlocks() const {
+  std::vector<int> blocks{base_.ndx()};
+  if (base_.jacobianStructure() == JacobianStructure::BLOCK_DIAGONAL)
+    blocks = base_.jacobianBlocks();
+  blocks.push_back(base_.ndx());
+  return blocks;
+}
+
 /// Operators
 template <class Base>
 void TangentBundleTpl<Base>::integrate_impl(const ConstVectorRef &x,
@@ -44,8 +53,8 @@ void TangentBundleTpl<Base>::Jintegrate_impl(const ConstVectorRef &x,
                                              const ConstVectorRef &dx,
                                              MatrixRef J_, int arg) const {
   const int nv_ = base_.ndx();
-  J_.resize(ndx(), ndx());
-  J_.setZero();
+  J_.topRightCorner(nv_, nv_).setZero();
+  J_.bottomLeftCorner(nv_, nv_).setZero();
   base_.Jintegrate(getBasePoint(x), getBaseTangent(dx), getBaseJacobian(J_),
                    arg);
   J_.bottomRightCorner(nv_, nv_).setIdentity();
@@ -56,14 +65,13 @@ void TangentBundleTpl<Base>::Jdifference_impl(const ConstVectorRef &x0,
                                               const ConstVectorRef &x1,
                                               MatrixRef J_, int arg) const {
   const int nv_ = base_.ndx();
-  J_.resize(ndx(), ndx());
-  J_.setZero();
+  J_.topRightCorner(nv_, nv_).setZero();
+  J_.bottomLeftCorner(nv_, nv_).setZero();
   base_.Jdifference(getBasePoint(x0), getBasePoint(x1), getBaseJacobian(J_),
                     arg);
+  J_.bottomRightCorner(nv_, nv_).setIdentity();
   if (arg == 0) {
-    J_.bottomRightCorner(nv_, nv_).diagonal().array() = Scalar(-1);
-  } else if (arg == 1) {
-    J_.bottomRightCorner(nv_, nv_).setIdentity();
+    J_.bottomRightCorner(nv_, nv_) *= Scalar(-1);
   }
 }
 
@@ -32,6 +32,10 @@ struct VectorSpaceTpl : public ManifoldAbstractTpl<_Scalar, _Options> {
   inline int nx() const { return dim_; }
   inline int ndx() const { return dim_; }
 
+  JacobianStructure jacobianStructure() const {
+    return JacobianStructure::IDENTITY;
+  }
+
   /// \name implementations
 
   /* Integrate */
@@ -74,6 +78,38 @@ struct VectorSpaceTpl : public ManifoldAbstractTpl<_Scalar, _Options> {
                         const Scalar &u, VectorRef out) const {
     out = u * x1 + (static_cast<Scalar>(1.) - u) * x0;
   }
+
+  /* Batched operations: the points are processed as a single matrix */
+
+  void integrate_batch_impl(const ConstMatrixRef &X, const ConstMatrixRef &V,
+                            MatrixRef Xout) const {
+    Xout = X + V;
+  }
+
+  void difference_batch_impl(const ConstMatrixRef &X0, const ConstMatrixRef &X1,
+                             MatrixRef Vout) const {
+    Vout = X1 - X0;
+  }
+
+  void Jintegrate_batch_impl(const ConstMatrixRef &X, const ConstMatrixRef &,
+                             MatrixRef Jout, int) const {
+    Jout = MatrixXs::Identity(ndx(), ndx()).replicate(1, X.cols());
+  }
+
+  void Jdifference_batch_impl(const ConstMatrixRef &X0,
+                              const ConstMatrixRef &, MatrixRef Jout,
+                              int arg) const {
+    switch (arg) {
+    case 0:
+      Jout = -MatrixXs::Identity(ndx(), ndx()).replicate(1, X0.cols());
+      break;
+    case 1:
+      Jout = MatrixXs::Identity(ndx(), ndx()).replicate(1, X0.cols());
+      break;
+    default:
+      throw std::runtime_error("Wrong arg value.");
+    }
+  }
 };
 
 } // namespace nlp
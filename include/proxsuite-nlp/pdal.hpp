@@ -30,13 +30,26 @@ public:
 
   ALMeritFunctionTpl(const Problem &prob, const Scalar &beta);
 
+  /// @brief Evaluate the merit function.
+  /// @pre The primal-dual multiplier estimates in @p workspace were computed
+  /// at the current point (see ProxNLPSolverTpl::computeMultipliers()).
   Scalar evaluate(const ConstVectorRef &x, const std::vector<VectorRef> &lams,
                   Workspace &workspace) const;
 
   void computeGradient(const std::vector<VectorRef> &lams,
                        Workspace &workspace) const;
 
+  /// @copybrief computeGradient()
+  /// @param jtlams_pdal  Precomputed product \f$J^\top\lambda_{pdal}\f$ of
+  /// the constraint Jacobian with the primal-dual multiplier estimate.
+  void computeGradient(const std::vector<VectorRef> &lams,
+                       const ConstVectorRef &jtlams_pdal,
+                       Workspace &workspace) const;
+
 private:
+  void computeDualGradient(const std::vector<VectorRef> &lams,
+                           Workspace &workspace) const;
+
   // fraction of mu to use in linesearch; reference to outer algorithm param
   const Scalar &beta_;
   const Problem &problem_;
@@ -16,13 +16,22 @@ Scalar ALMeritFunctionTpl<Scalar>::evaluate(const ConstVectorRef & /*x*/,
                                             const std::vector<VectorRef> &lams,
                                             Workspace &workspace) const {
   Scalar res = workspace.objective_value;
-  // value c(x) + \mu\lambda_e
-  const auto &pd_scv = workspace.shift_cstr_pdal;
+  // The normal cone projection of the shifted constraints
+  // c(x) + \mu(\lambda_e - \lambda/2) is the primal-dual multiplier estimate
+  // scaled by beta * mu: the Moreau envelope
+  // g(z - ncp) + ||ncp||^2 / (2 mu) is evaluated from it, one batch at a time.
+  const auto &pd_scv = workspace.data_shift_cstr_pdal;
+  const auto &lams_pdal = workspace.data_lams_pdal;
+  for (const auto &batch : workspace.batches) {
+    const Scalar mu = batch.set->mu();
+    auto zprox = workspace.data_prox_pdal.segment(batch.index, batch.dim);
+    auto lp = lams_pdal.segment(batch.index, batch.dim);
+    zprox = pd_scv.segment(batch.index, batch.dim) - beta_ * mu * lp;
+    res += 2.0 * batch.set->evaluate(zprox);
+    res += beta_ * beta_ * mu * lp.squaredNorm();
+  }
   for (std::size_t i = 0; i < workspace.numblocks; i++) {
-    const ConstraintObject &cstr = problem_.getConstraint(i);
-    Scalar mu = cstr.set_->mu();
-    VectorXs scv_tmp = pd_scv[i];
-    res += 2.0 * cstr.set_->computeMoreauEnvelope(pd_scv[i], scv_tmp);
+    const Scalar mu = problem_.getConstraint(i).set_->mu();
     res += mu * lams[i].squaredNorm() / 4.0;
   }
   return res;
@@ -32,8 +41,23 @@ template <typename Scalar>
 void ALMeritFunctionTpl<Scalar>::computeGradient(
     const std::vector<VectorRef> &lams, Workspace &workspace) const {
   workspace.merit_gradient = workspace.objective_gradient;
-  workspace.merit_gradient.noalias() +=
-      workspace.data_jacobians.transpose() * workspace.data_lams_pdal;
+  problem_.addJacobianTransposeProduct(workspace.data_jacobians,
+                                       workspace.data_lams_pdal,
+                                       workspace.merit_gradient);
+  computeDualGradient(lams, workspace);
+}
+
+template <typename Scalar>
+void ALMeritFunctionTpl<Scalar>::computeGradient(
+    const std::vector<VectorRef> &lams, const ConstVectorRef &jtlams_pdal,
+    Workspace &workspace) const {
+  workspace.merit_gradient = workspace.objective_gradient + jtlams_pdal;
+  computeDualGradient(lams, workspace);
+}
+
+template <typename Scalar>
+void ALMeritFunctionTpl<Scalar>::computeDualGradient(
+    const std::vector<VectorRef> &lams, Workspace &workspace) const {
   workspace.merit_dual_gradient.setZero();
   for (std::size_t i = 0; i < workspace.numblocks; i++) {
     const ConstraintObject &cstr = problem_.getConstraint(i);
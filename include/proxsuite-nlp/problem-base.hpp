@@ -5,6 +5,7 @@
 #include "proxsuite-nlp/manifold-base.hpp"
 #include "proxsuite-nlp/cost-function.hpp"
 #include "proxsuite-nlp/constraint-set.hpp"
+#include "proxsuite-nlp/evaluation-cache.hpp"
 
 namespace proxsuite {
 namespace nlp {
@@ -73,9 +74,81 @@ public:
 
   int getIndex(std::size_t i) const { return indices_[i]; }
 
+  /// @brief Whether some constraint function declares zero Jacobian columns.
+  /// @details This reads the current declarations of the functions, which may
+  /// change after the problem is built (see C1FunctionTpl::setJacobianColumns).
+  bool hasSparseJacobians() const {
+    for (const ConstraintObject &cstr : constraints_) {
+      if (cstr.func().hasSparseJacobian())
+        return true;
+    }
+    return false;
+  }
+
+  /// @brief Register a cache shared by the problem functions. It is
+  /// invalidated by evaluate() and evaluateWithDerivatives(), through which
+  /// the solver evaluates the problem at each new point.
+  void addCache(shared_ptr<EvaluationCacheBase> cache) {
+    caches_.push_back(std::move(cache));
+  }
+
+  /// @brief Whether the problem functions share evaluation caches. They are
+  /// then not safe to evaluate concurrently.
+  bool hasCaches() const { return !caches_.empty(); }
+
+  /// @brief Whether the cost and constraint functions may be evaluated
+  /// concurrently: they are all thread-safe (see
+  /// BaseFunctionTpl::isThreadSafe()) and share no evaluation cache.
+  bool isThreadSafe() const {
+    if (hasCaches() || !cost_->isThreadSafe())
+      return false;
+    for (const ConstraintObject &cstr : constraints_) {
+      if (!cstr.func().isThreadSafe())
+        return false;
+    }
+    return true;
+  }
+
+  void invalidateCaches() const {
+    for (const auto &cache : caches_)
+      cache->invalidate();
+  }
+
+  /**
+   * @brief Accumulate \f$ out \mathrel{+}= J^\top \lambda \f$ where @p jacobians
+   * holds the stacked constraint Jacobians.
+   *
+   * @details Only the column blocks declared through
+   * C1FunctionTpl::setJacobianColumns() are read. @p lams may hold several
+   * right-hand sides (one per column), computed in a single pass over the
+   * Jacobian.
+   */
+  void addJacobianTransposeProduct(const ConstMatrixRef &jacobians,
+                                   const ConstMatrixRef &lams,
+                                   MatrixRef out) const {
+    if (!hasSparseJacobians()) {
+      out.noalias() += jacobians.transpose() * lams;
+      return;
+    }
+    for (std::size_t i = 0; i < getNumConstraints(); i++) {
+      const auto &func = constraints_[i].func();
+      const int c0 = func.jacobianColStart();
+      const int nc = func.jacobianColSize();
+      out.middleRows(c0, nc).noalias() +=
+          jacobians.block(indices_[i], c0, ncs_[i], nc).transpose() *
+          lams.middleRows(indices_[i], ncs_[i]);
+    }
+  }
+
   void evaluate(const ConstVectorRef &x, Workspace &workspace) const {
+    invalidateCaches();
     workspace.objective_value = cost().call(x);
+    evaluateConstraints(x, workspace);
+  }
 
+  /// Evaluate the constraint functions only.
+  void evaluateConstraints(const ConstVectorRef &x,
+                           Workspace &workspace) const {
     for (std::size_t i = 0; i < getNumConstraints(); i++) {
       const ConstraintObject &cstr = constraints_[i];
       workspace.cstr_values[i] = cstr.func()(x);
@@ -91,6 +164,21 @@ public:
     }
   }
 
+  /// Evaluate the problem functions along with their first-order derivatives,
+  /// with a single call per constraint (see
+  /// C1FunctionTpl::evaluateWithJacobian()).
+  void evaluateWithDerivatives(const ConstVectorRef &x,
+                               Workspace &workspace) const {
+    invalidateCaches();
+    workspace.objective_value = cost().call(x);
+    cost().computeGradient(x, workspace.objective_gradient);
+    for (std::size_t i = 0; i < getNumConstraints(); i++) {
+      const ConstraintObject &cstr = constraints_[i];
+      cstr.func().evaluateWithJacobian(x, workspace.cstr_values[i],
+                                       workspace.cstr_jacobians[i]);
+    }
+  }
+
   void computeHessians(const ConstVectorRef &x, Workspace &workspace,
                        bool evaluate_all_constraint_hessians = false) const {
     cost().computeHessian(x, workspace.objective_hessian);
@@ -109,6 +197,7 @@ protected:
   int nc_total_;
   std::vector<int> ncs_;
   std::vector<int> indices_;
+  std::vector<shared_ptr<EvaluationCacheBase>> caches_;
 
   /// Set values of const data members for constraint dimensions
   void reset_constraint_dim_vars() {
@@ -15,7 +15,10 @@
 
 #include "proxsuite-nlp/modelling/costs/squared-distance.hpp"
 
+#include "proxsuite-nlp/proximal-penalty.hpp"
 #include "proxsuite-nlp/linesearch-base.hpp"
+#include "proxsuite-nlp/trust-region.hpp"
+#include "proxsuite-nlp/thread-pool.hpp"
 
 namespace proxsuite {
 namespace nlp {
@@ -48,6 +51,7 @@ public:
   using CallbackPtr = shared_ptr<helpers::base_callback<Scalar>>;
   using ConstraintSet = ConstraintSetTpl<Scalar>;
   using ConstraintObject = ConstraintObjectTpl<Scalar>;
+  using ActiveType = typename ConstraintSet::ActiveType;
 
 protected:
   /// General nonlinear program to solve.
@@ -57,12 +61,14 @@ public:
   /// Merit function.
   ALMeritFunctionTpl<Scalar> merit_fun;
   /// Proximal regularization penalty.
-  QuadraticDistanceCostTpl<Scalar> prox_penalty;
+  ProximalPenaltyTpl<Scalar> prox_penalty;
 
   /// Level of verbosity of the solver.
   VerboseLevel verbose = QUIET;
   /// Use a Gauss-Newton approximation for the Lagrangian Hessian.
   HessianApprox hess_approx = HessianApprox::GAUSS_NEWTON;
+  /// Globalization strategy of the inner loop.
+  GlobalizationStrategy globalization = GlobalizationStrategy::LINESEARCH;
   /// Linesearch strategy.
   LinesearchStrategy ls_strat = LinesearchStrategy::ARMIJO;
   MultiplierUpdateMode mul_update_mode = MultiplierUpdateMode::NEWTON;
@@ -97,6 +103,9 @@ public:
   /// Linesearch options.
   LinesearchOptions ls_options;
 
+  /// Trust-region parameters, for GlobalizationStrategy::TRUST_REGION.
+  TrustRegionParamsTpl<Scalar> tr_params;
+
   /// Target tolerance for the problem.
   Scalar target_tol;
 
@@ -121,6 +130,12 @@ public:
 
   unique_ptr<Workspace> workspace_;
   unique_ptr<Results> results_;
+  /// Additional workspaces for the linesearch trials (see
+  /// LinesearchOptions::parallel_trials), allocated by setup().
+  std::vector<unique_ptr<Workspace>> trial_workspaces_;
+  /// Workers evaluating the linesearch trials concurrently, started by
+  /// setup().
+  unique_ptr<ThreadPool> thread_pool_;
 
   ProxNLPSolverTpl(Problem &prob, const Scalar tol = 1e-6,
                    const Scalar mu_eq_init = 1e-2, const Scalar rho_init = 0.,
@@ -138,6 +153,7 @@ public:
   void setup() {
     workspace_ = std::make_unique<Workspace>(*problem_, ldlt_choice_);
     results_ = std::make_unique<Results>(*problem_);
+    allocateTrials();
   }
 
   /**
@@ -240,6 +256,10 @@ public:
   void computeProblemDerivatives(const ConstVectorRef &x, Workspace &workspace,
                                  boost::mpl::true_) const;
 
+  /// Apply the normal cone projection Jacobians to the constraint Jacobians
+  /// of the sets which are not handled as active-set masks.
+  void computeProjectedJacobians(Workspace &workspace) const;
+
   /**
    * Compute the primal residuals at the current primal-dual pair \f$(x,
    * \lambda^+)\f$, where the multipliers are chosen to be the predicted next
@@ -248,6 +268,19 @@ public:
    */
   void computePrimalResiduals(Workspace &workspace, Results &results) const;
 
+  /**
+   * Compute all the products of the transposed constraint Jacobian needed in
+   * an iteration (for the KKT right-hand side and its symmetric correction,
+   * the dual residual and the merit function gradient) as a single
+   * multiple right-hand side product, stored in WorkspaceTpl::jac_tr_prod.
+   */
+  void computeJacobianTransposeProducts(Workspace &workspace,
+                                        const Results &results) const;
+
+  /// @brief Throw if the Jacobian column blocks of the constraint functions
+  /// changed since the workspace batches were built in setup().
+  void checkJacobianColumns(const Workspace &workspace) const;
+
   /**
    * Take a trial step.
    *
@@ -257,6 +290,47 @@ public:
    */
   void tryStep(Workspace &workspace, const Results &results, Scalar alpha);
 
+  /// @brief Allocate the workspaces and the thread pool for
+  /// LinesearchOptions::parallel_trials step sizes.
+  void allocateTrials();
+
+  /**
+   * @brief Evaluate the merit function at several step sizes, each on its own
+   * workspace.
+   *
+   * @details The trials run concurrently on the thread pool only if the
+   * problem is thread-safe (see ProblemTpl::isThreadSafe()), and one after
+   * the other otherwise. Failed evaluations output an infinite value.
+   *
+   * @param[in]  results  Contains the previous primal-dual point
+   * @param[in]  alphas   Step sizes
+   * @param[out] values   Merit function values
+   */
+  void evaluateTrials(const Results &results, const std::vector<Scalar> &alphas,
+                      std::vector<Scalar> &values);
+
+  /**
+   * @brief Compute a dogleg step between the Cauchy point of the merit function
+   * and the Newton step, and adapt the trust-region radius.
+   *
+   * @details The Newton step in the workspace is reused for every trial radius,
+   * and the accepted step overwrites it. A step is only accepted if its merit
+   * value is finite and decreases enough w.r.t. the model prediction.
+   *
+   * @param workspace Workspace, holding the Newton step and merit gradients
+   * @param phi       Merit function at the current point plus a step of the
+   * given size, returning a non-finite value if the evaluation failed
+   * @param phi0      Merit value at the current point
+   * @param delta     Primal regularization of the KKT factorization
+   * @param[out] phi_new  Merit value at the accepted step
+   * @returns Whether a step was accepted, before the radius fell under
+   * TrustRegionParamsTpl::radius_min or TrustRegionParamsTpl::max_trials
+   * steps were rejected.
+   */
+  template <typename Fn>
+  bool trustRegionStep(Workspace &workspace, Fn &&phi, const Scalar phi0,
+                       const Scalar delta, Scalar &phi_new);
+
   void invokeCallbacks(Workspace &workspace, Results &results) {
     for (auto cb : callbacks_) {
       cb->call(workspace, results);
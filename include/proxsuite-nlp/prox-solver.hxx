@@ -5,10 +5,13 @@
 
 #include "proxsuite-nlp/prox-solver.hpp"
 #include "proxsuite-nlp/linesearch-armijo.hpp"
+#include "proxsuite-nlp/linesearch-wolfe.hpp"
 
 #include <fmt/ostream.h>
 #include <fmt/color.h>
 
+#include <limits>
+
 namespace proxsuite {
 namespace nlp {
 template <typename Scalar>
@@ -19,9 +22,7 @@ ProxNLPSolverTpl<Scalar>::ProxNLPSolverTpl(
     const Scalar dual_beta, LDLTChoice ldlt_choice,
     const LinesearchOptions ls_options)
     : problem_(&prob), merit_fun(*problem_, pdal_beta_),
-      prox_penalty(prob.manifold_, manifold().neutral(),
-                   rho_init *
-                       MatrixXs::Identity(manifold().ndx(), manifold().ndx())),
+      prox_penalty(prob.manifold_, manifold().neutral(), rho_init),
       verbose(verbose), ldlt_choice_(ldlt_choice), rho_init_(rho_init),
       mu_init_(mu_init), mu_lower_(mu_lower),
       bcl_params{prim_alpha, prim_beta, dual_alpha, dual_beta},
@@ -60,6 +61,14 @@ ConvergenceFlag ProxNLPSolverTpl<Scalar>::solve(const ConstVectorRef &x0,
 
   auto &results = *results_;
   auto &workspace = *workspace_;
+  checkJacobianColumns(workspace);
+  if (trial_workspaces_.size() + 1 <
+      std::max(ls_options.parallel_trials, std::size_t(1)))
+    allocateTrials();
+  // the constraint sets of the problem may have changed since setup()
+  workspace.updateBatches(*problem_);
+  for (const auto &ws : trial_workspaces_)
+    ws->updateBatches(*problem_);
 
   setPenalty(mu_init_);
   setProxParameter(rho_init_);
@@ -85,6 +94,8 @@ ConvergenceFlag ProxNLPSolverTpl<Scalar>::solve(const ConstVectorRef &x0,
     results.mu = mu_;
     results.rho = rho_;
     innerLoop(workspace, results);
+    if (results.converged == ConvergenceFlag::TRUST_REGION_FAILURE)
+      break;
 
     // accept new primal iterate
     workspace.x_prev = results.x_opt;
@@ -115,6 +126,10 @@ ConvergenceFlag ProxNLPSolverTpl<Scalar>::solve(const ConstVectorRef &x0,
     fmt::print(fmt::fg(fmt::color::orange_red),
                "Max number of iterations reached.");
     break;
+  case TRUST_REGION_FAILURE:
+    fmt::print(fmt::fg(fmt::color::orange_red),
+               "No acceptable step within the trust region.");
+    break;
   default:
     break;
   }
@@ -171,35 +186,32 @@ void ProxNLPSolverTpl<Scalar>::computeMultipliers(
   PROXSUITE_NLP_NOMALLOC_BEGIN;
   workspace.data_shift_cstr_values =
       workspace.data_cstr_values + mu_ * workspace.data_lams_prev;
-  // project multiplier estimate
-  for (std::size_t i = 0; i < problem_->getNumConstraints(); i++) {
-    const ConstraintSet &cstr_set = *problem_->getConstraint(i).set_;
-    // apply proximal op to shifted constraint
-    cstr_set.normalConeProjection(workspace.shift_cstr_values[i],
-                                  workspace.lams_plus[i]);
-  }
-  workspace.data_lams_plus = mu_inv_ * workspace.data_lams_plus;
   // compute primal-dual multiplier estimates:
   // normalConeProj(w), w = c(x) + mu(lambda_k - (beta-1)lambda)
   workspace.data_shift_cstr_pdal =
       workspace.data_shift_cstr_values - 0.5 * mu_ * inner_lams_data;
-  for (std::size_t i = 0; i < problem_->getNumConstraints(); i++) {
-    const ConstraintSet &cstr_set = *problem_->getConstraint(i).set_;
-    cstr_set.normalConeProjection(workspace.shift_cstr_pdal[i],
-                                  workspace.lams_pdal[i]);
+  // apply the proximal operators to the shifted constraints, reapply the prox
+  // operator Jacobian to the multiplier estimates and compute the active sets,
+  // in one call per batch of constraint blocks
+  for (std::size_t k = 0; k < workspace.batches.size(); k++) {
+    const auto &batch = workspace.batches[k];
+    const int idx = batch.index;
+    const int nr = batch.dim;
+    batch.set->computeAll(
+        workspace.data_shift_cstr_values.segment(idx, nr),
+        workspace.data_shift_cstr_pdal.segment(idx, nr),
+        workspace.data_lams_plus.segment(idx, nr),
+        workspace.data_lams_pdal.segment(idx, nr),
+        workspace.data_lams_plus_reproj.segment(idx, nr),
+        workspace.data_lams_pdal_reproj.segment(idx, nr),
+        workspace.data_active_set.segment(idx, nr),
+        workspace.data_active_set_pdal.segment(idx, nr));
   }
+  // the projection Jacobians are linear: scale after reprojecting
+  workspace.data_lams_plus *= mu_inv_;
+  workspace.data_lams_plus_reproj *= mu_inv_;
   workspace.data_lams_pdal *= mu_inv_ / pdal_beta_;
-
-  workspace.data_lams_plus_reproj = workspace.data_lams_plus;
-  workspace.data_lams_pdal_reproj = workspace.data_lams_pdal;
-  for (std::size_t i = 0; i < problem_->getNumConstraints(); i++) {
-    const ConstraintSet &cstr_set = *problem_->getConstraint(i).set_;
-    // reapply the prox operator Jacobian to multiplier estimate
-    cstr_set.applyProjectionJacobian(workspace.shift_cstr_values[i],
-                                     workspace.lams_plus_reproj[i]);
-    cstr_set.applyProjectionJacobian(workspace.shift_cstr_pdal[i],
-                                     workspace.lams_pdal_reproj[i]);
-  }
+  workspace.data_lams_pdal_reproj *= mu_inv_ / pdal_beta_;
   PROXSUITE_NLP_NOMALLOC_END;
 }
 
@@ -207,20 +219,29 @@ template <typename Scalar>
 void ProxNLPSolverTpl<Scalar>::computeProblemDerivatives(
     const ConstVectorRef &x, Workspace &workspace, boost::mpl::false_) const {
   problem_->computeDerivatives(x, workspace);
+  computeProjectedJacobians(workspace);
+}
 
-  workspace.data_jacobians_proj = workspace.data_jacobians;
-  for (std::size_t i = 0; i < problem_->getNumConstraints(); i++) {
-    const ConstraintSet &cstr_set = *problem_->getConstraint(i).set_;
-    switch (kkt_system_) {
-    case KKT_CLASSIC:
-      cstr_set.applyNormalConeProjectionJacobian(
-          workspace.shift_cstr_values[i], workspace.cstr_jacobians_proj[i]);
-      break;
-    case KKT_PRIMAL_DUAL:
-      cstr_set.applyNormalConeProjectionJacobian(
-          workspace.shift_cstr_pdal[i], workspace.cstr_jacobians_proj[i]);
-      break;
-    }
+template <typename Scalar>
+void ProxNLPSolverTpl<Scalar>::computeProjectedJacobians(
+    Workspace &workspace) const {
+  const VectorXs &shift = kkt_system_ == KKT_CLASSIC
+                              ? workspace.data_shift_cstr_values
+                              : workspace.data_shift_cstr_pdal;
+  for (std::size_t k = 0; k < workspace.batches.size(); k++) {
+    const auto &batch = workspace.batches[k];
+    // diagonal projection Jacobians are applied as masks in the KKT assembly
+    if (batch.diagonal)
+      continue;
+    const int idx = batch.index;
+    const int nr = batch.dim;
+    // only the nonzero columns of the Jacobian are projected
+    const int c0 = batch.col_start;
+    const int nc = batch.col_size;
+    MatrixRef jac_proj = workspace.data_jacobians_proj.block(idx, c0, nr, nc);
+    jac_proj = workspace.data_jacobians.block(idx, c0, nr, nc);
+    batch.set->applyNormalConeProjectionJacobian(shift.segment(idx, nr),
+                                                 jac_proj);
   }
 }
 
@@ -238,19 +259,66 @@ void ProxNLPSolverTpl<Scalar>::computePrimalResiduals(Workspace &workspace,
   workspace.data_shift_cstr_values =
       workspace.data_cstr_values + mu_ * results.data_lams_opt;
 
-  for (std::size_t i = 0; i < problem_->getNumConstraints(); i++) {
-    const ConstraintSet &cstr_set = *problem_->getConstraint(i).set_;
-    auto displ_cstr = workspace.shift_cstr_values[i];
+  for (std::size_t k = 0; k < workspace.batches.size(); k++) {
+    const auto &batch = workspace.batches[k];
+    auto displ_cstr =
+        workspace.data_shift_cstr_values.segment(batch.index, batch.dim);
     // apply proximal operator
-    cstr_set.projection(displ_cstr, displ_cstr);
-
-    auto cstr_prox_err = workspace.cstr_values[i] - displ_cstr;
+    batch.set->projection(displ_cstr, displ_cstr);
+  }
+  for (std::size_t i = 0; i < problem_->getNumConstraints(); i++) {
+    auto cstr_prox_err =
+        workspace.cstr_values[i] - workspace.shift_cstr_values[i];
     results.constraint_violations(long(i)) = math::infty_norm(cstr_prox_err);
   }
   results.prim_infeas = math::infty_norm(results.constraint_violations);
   PROXSUITE_NLP_NOMALLOC_END;
 }
 
+template <typename Scalar>
+void ProxNLPSolverTpl<Scalar>::computeJacobianTransposeProducts(
+    Workspace &workspace, const Results &results) const {
+  auto &rhs = workspace.jac_tr_rhs;
+  rhs.col(0) = results.data_lams_opt;
+  // the symmetric-system correction is J_proj^T lams - J^T lams +
+  // J^T lams_reproj; since J_proj = P J for the (symmetric) normal cone
+  // projection Jacobian P, it is a single product with P lams - lams +
+  // lams_reproj.
+  rhs.col(1) = results.data_lams_opt;
+  const VectorXs &shift = kkt_system_ == KKT_CLASSIC
+                              ? workspace.data_shift_cstr_values
+                              : workspace.data_shift_cstr_pdal;
+  const ActiveType &mask = kkt_system_ == KKT_CLASSIC
+                               ? workspace.data_active_set
+                               : workspace.data_active_set_pdal;
+  for (std::size_t k = 0; k < workspace.batches.size(); k++) {
+    const auto &batch = workspace.batches[k];
+    const int idx = batch.index;
+    const int nr = batch.dim;
+    auto plams = rhs.col(1).segment(idx, nr);
+    if (batch.diagonal) {
+      plams = mask.segment(idx, nr).select(plams, Scalar(0.));
+    } else {
+      batch.set->applyNormalConeProjectionJacobian(shift.segment(idx, nr),
+                                                   plams);
+    }
+  }
+  rhs.col(1) -= results.data_lams_opt;
+  switch (kkt_system_) {
+  case KKT_CLASSIC:
+    rhs.col(1) += workspace.data_lams_plus_reproj;
+    break;
+  case KKT_PRIMAL_DUAL:
+    rhs.col(1) += workspace.data_lams_pdal_reproj;
+    break;
+  }
+  rhs.col(2) = workspace.data_lams_pdal;
+
+  workspace.jac_tr_prod.setZero();
+  problem_->addJacobianTransposeProduct(workspace.data_jacobians, rhs,
+                                        workspace.jac_tr_prod);
+}
+
 template <typename Scalar> void ProxNLPSolverTpl<Scalar>::updatePenalty() {
   if (mu_ == mu_lower_) {
     setPenalty(mu_init_);
@@ -270,27 +338,66 @@ void ProxNLPSolverTpl<Scalar>::innerLoop(Workspace &workspace,
   Scalar delta_last = 0.;
   Scalar delta = delta_last;
   Scalar phi_new = 0.;
+  workspace.tr_radius = tr_params.radius_init;
+  // the merit function changes with the AL parameters
+  workspace.merit_history.reset();
+
+  // lambda for evaluating the merit function; failed evaluations of the
+  // problem functions are reported to the globalization as an infinite value
+  auto phi_eval = [&](const Scalar alpha) -> Scalar {
+    try {
+      tryStep(workspace, results, alpha);
+      problem_->evaluate(workspace.x_trial, workspace);
+      computeMultipliers(workspace.data_lams_trial, workspace);
+      return merit_fun.evaluate(workspace.x_trial, workspace.lams_trial,
+                                workspace) +
+             prox_penalty.call(workspace.x_trial);
+    } catch (const std::runtime_error &) {
+      return std::numeric_limits<Scalar>::infinity();
+    }
+  };
 
-  // lambda for evaluating the merit function
-  auto phi_eval = [&](const Scalar alpha) {
-    tryStep(workspace, results, alpha);
-    problem_->evaluate(workspace.x_trial, workspace);
-    computeMultipliers(workspace.data_lams_trial, workspace);
-    return merit_fun.evaluate(workspace.x_trial, workspace.lams_trial,
-                              workspace) +
-           prox_penalty.call(workspace.x_trial);
+  // lambda for evaluating the merit function and its derivative along the
+  // step; this also evaluates the problem derivatives at the trial point. The
+  // primal step is transported to the trial point, as the derivative of
+  // alpha -> x (+) alpha * dx
+  Scalar alpha_last_eval = -1.;
+  auto phi_dphi_eval = [&](const Scalar alpha, Scalar &dphi) {
+    const Scalar phi = phi_eval(alpha);
+    alpha_last_eval = std::isfinite(phi) ? alpha : Scalar(-1.);
+    if (alpha_last_eval < 0.)
+      return phi;
+    problem_->computeDerivatives(workspace.x_trial, workspace);
+    merit_fun.computeGradient(workspace.lams_trial, workspace);
+    // tryStep() left alpha * dx in tmp_dx_scaled
+    workspace.tmp_dx_transported = workspace.prim_step;
+    manifold().JintegrateTransport(results.x_opt, workspace.tmp_dx_scaled,
+                                   workspace.tmp_dx_transported, 1);
+    dphi = workspace.merit_gradient.dot(workspace.tmp_dx_transported) +
+           workspace.merit_dual_gradient.dot(workspace.dual_step);
+    if (rho_ > 0.) {
+      prox_penalty.computeGradient(workspace.x_trial, workspace.prox_grad);
+      dphi += workspace.prox_grad.dot(workspace.tmp_dx_transported);
+    }
+    return phi;
   };
+  // whether the problem was evaluated, with its first-order derivatives, at
+  // the current iterate by the linesearch
+  bool reuse_trial = false;
 
   while (true) {
 
-    problem_->evaluate(results.x_opt, workspace);
-    computeMultipliers(results.data_lams_opt, workspace);
-    computeProblemDerivatives(results.x_opt, workspace, boost::mpl::true_());
+    if (!reuse_trial) {
+      problem_->evaluateWithDerivatives(results.x_opt, workspace);
+      computeMultipliers(results.data_lams_opt, workspace);
+    }
+    computeProjectedJacobians(workspace);
+    problem_->computeHessians(results.x_opt, workspace,
+                              hess_approx == HessianApprox::EXACT);
 
     for (std::size_t i = 0; i < num_c; i++) {
-      const ConstraintSet &cstr_set = *problem_->getConstraint(i).set_;
-      cstr_set.computeActiveSet(workspace.shift_cstr_values[i],
-                                results.active_set[i]);
+      results.active_set[i] = workspace.data_active_set.segment(
+          problem_->getIndex(i), problem_->getConstraintDim(i));
     }
 
     results.value = workspace.objective_value;
@@ -300,8 +407,10 @@ void ProxNLPSolverTpl<Scalar>::innerLoop(Workspace &workspace,
     if (rho_ > 0.) {
       results.merit += prox_penalty.call(results.x_opt);
       prox_penalty.computeGradient(results.x_opt, workspace.prox_grad);
-      prox_penalty.computeHessian(results.x_opt, workspace.prox_hess);
     }
+    workspace.merit_history.push(ls_options, results.merit);
+
+    computeJacobianTransposeProducts(workspace, results);
 
     PROXSUITE_NLP_NOMALLOC_BEGIN;
     //// fill in KKT RHS
@@ -309,9 +418,9 @@ void ProxNLPSolverTpl<Scalar>::innerLoop(Workspace &workspace,
     workspace.kkt_rhs_corr.setZero();
 
     // add jacobian-vector products to gradients
-    workspace.kkt_rhs.head(ndx) = workspace.objective_gradient;
-    workspace.kkt_rhs.head(ndx).noalias() +=
-        workspace.data_jacobians.transpose() * results.data_lams_opt;
+    workspace.dual_residual =
+        workspace.objective_gradient + workspace.jac_tr_prod.col(0);
+    workspace.kkt_rhs.head(ndx) = workspace.dual_residual;
 
     switch (kkt_system_) {
     case KKT_CLASSIC:
@@ -324,7 +433,8 @@ void ProxNLPSolverTpl<Scalar>::innerLoop(Workspace &workspace,
       break;
     }
 
-    merit_fun.computeGradient(results.lams_opt, workspace);
+    merit_fun.computeGradient(results.lams_opt, workspace.jac_tr_prod.col(2),
+                              workspace);
     // add proximal penalty terms
     if (rho_ > 0.) {
       workspace.kkt_rhs.head(ndx) += workspace.prox_grad;
@@ -336,10 +446,6 @@ void ProxNLPSolverTpl<Scalar>::innerLoop(Workspace &workspace,
 
     computePrimalResiduals(workspace, results);
 
-    // compute dual residual
-    workspace.dual_residual = workspace.objective_gradient;
-    workspace.dual_residual.noalias() +=
-        workspace.data_jacobians.transpose() * results.data_lams_opt;
     results.dual_infeas = math::infty_norm(workspace.dual_residual);
     Scalar inner_crit = math::infty_norm(workspace.kkt_rhs);
     Scalar outer_crit = std::max(results.prim_infeas, results.dual_infeas);
@@ -353,22 +459,7 @@ void ProxNLPSolverTpl<Scalar>::innerLoop(Workspace &workspace,
     // If not optimal: compute the step
 
     // correct the rhs for the symmetric system
-    workspace.kkt_rhs_corr.head(ndx).noalias() -=
-        workspace.data_jacobians.transpose() * results.data_lams_opt;
-    workspace.kkt_rhs_corr.head(ndx).noalias() +=
-        workspace.data_jacobians_proj.transpose() * results.data_lams_opt;
-    switch (kkt_system_) {
-    case KKT_CLASSIC:
-      workspace.kkt_rhs_corr.head(ndx).noalias() +=
-          workspace.data_jacobians.transpose() *
-          workspace.data_lams_plus_reproj;
-      break;
-    case KKT_PRIMAL_DUAL:
-      workspace.kkt_rhs_corr.head(ndx).noalias() +=
-          workspace.data_jacobians.transpose() *
-          workspace.data_lams_pdal_reproj;
-      break;
-    }
+    workspace.kkt_rhs_corr.head(ndx) = workspace.jac_tr_prod.col(1);
     // apply correction
     workspace.kkt_rhs += workspace.kkt_rhs_corr;
 
@@ -425,16 +516,49 @@ void ProxNLPSolverTpl<Scalar>::innerLoop(Workspace &workspace,
 
     Scalar phi0 = results.merit;
     Scalar dphi0 = workspace.dmerit_dir;
-    switch (ls_strat) {
-    case LinesearchStrategy::ARMIJO: {
-      phi_new = ArmijoLinesearch<Scalar>(ls_options)
-                    .run(phi_eval, results.merit, dphi0, workspace.alpha_opt);
-      break;
-    }
-    default:
-      PROXSUITE_NLP_RUNTIME_ERROR("Unrecognized linesearch alternative.\n");
-      break;
+    if (globalization == GlobalizationStrategy::TRUST_REGION) {
+      if (!trustRegionStep(workspace, phi_eval, phi0, delta, phi_new)) {
+        // no acceptable step within the trust region: keep the current
+        // iterate, whose evaluation the trials overwrote, and stop the solve
+        problem_->evaluate(results.x_opt, workspace);
+        computeMultipliers(results.data_lams_opt, workspace);
+        results.converged = ConvergenceFlag::TRUST_REGION_FAILURE;
+        return;
+      }
+      workspace.alpha_opt = 1.;
+    } else {
+      switch (ls_strat) {
+      case LinesearchStrategy::ARMIJO: {
+        ArmijoLinesearch<Scalar> linesearch(ls_options);
+        const Scalar phi_ref =
+            workspace.merit_history.value(ls_options, results.merit);
+        if (ls_options.parallel_trials > 1) {
+          auto phi_eval_batch = [&](const std::vector<Scalar> &alphas,
+                                    std::vector<Scalar> &values) {
+            evaluateTrials(results, alphas, values);
+          };
+          phi_new = linesearch.runBatched(phi_eval_batch, results.merit, dphi0,
+                                          workspace.alpha_opt, phi_ref);
+        } else {
+          phi_new = linesearch.run(phi_eval, results.merit, dphi0,
+                                   workspace.alpha_opt, phi_ref);
+        }
+        break;
+      }
+      case LinesearchStrategy::WOLFE: {
+        phi_new = WolfeLinesearch<Scalar>(ls_options)
+                      .run(phi_dphi_eval, results.merit, dphi0,
+                           workspace.alpha_opt);
+        break;
+      }
+      default:
+        PROXSUITE_NLP_RUNTIME_ERROR("Unrecognized linesearch alternative.\n");
+        break;
+      }
     }
+    reuse_trial = (globalization == GlobalizationStrategy::LINESEARCH) &&
+                  (ls_strat == LinesearchStrategy::WOLFE) &&
+                  (workspace.alpha_opt == alpha_last_eval);
 
     tryStep(workspace, results, workspace.alpha_opt);
 
@@ -477,15 +601,31 @@ void ProxNLPSolverTpl<Scalar>::assembleKktMatrix(Workspace &workspace) {
   const long ndual = workspace.numdual;
   workspace.kkt_matrix.setZero();
   workspace.kkt_matrix.topLeftCorner(ndx, ndx) = workspace.objective_hessian;
-  workspace.kkt_matrix.topRightCorner(ndx, ndual) =
-      workspace.data_jacobians_proj.transpose();
-  workspace.kkt_matrix.bottomLeftCorner(ndual, ndx) =
-      workspace.data_jacobians_proj;
+  const ActiveType &mask = kkt_system_ == KKT_CLASSIC
+                               ? workspace.data_active_set
+                               : workspace.data_active_set_pdal;
+  // only fill in the nonzero column blocks of the projected Jacobians
+  for (std::size_t k = 0; k < workspace.batches.size(); k++) {
+    const auto &batch = workspace.batches[k];
+    const int idx = batch.index;
+    const int nr = batch.dim;
+    const int c0 = batch.col_start;
+    const int nc = batch.col_size;
+    auto kkt_rows = workspace.kkt_matrix.block(ndx + idx, c0, nr, nc);
+    if (batch.diagonal) {
+      kkt_rows.noalias() =
+          mask.segment(idx, nr).template cast<Scalar>().asDiagonal() *
+          workspace.data_jacobians.block(idx, c0, nr, nc);
+    } else {
+      kkt_rows = workspace.data_jacobians_proj.block(idx, c0, nr, nc);
+    }
+    workspace.kkt_matrix.block(c0, ndx + idx, nc, nr) = kkt_rows.transpose();
+  }
   auto lower_right_block = workspace.kkt_matrix.bottomRightCorner(ndual, ndual);
   lower_right_block.diagonal().setConstant(-mu_);
 
   if (rho_ > 0.) {
-    workspace.kkt_matrix.topLeftCorner(ndx, ndx) += workspace.prox_hess;
+    prox_penalty.addHessian(workspace.kkt_matrix.topLeftCorner(ndx, ndx));
   }
   for (std::size_t i = 0; i < workspace.numblocks; i++) {
     const ConstraintSet &cstr_set = *problem_->getConstraint(i).set_;
@@ -495,16 +635,25 @@ void ProxNLPSolverTpl<Scalar>::assembleKktMatrix(Workspace &workspace) {
       workspace.kkt_matrix.topLeftCorner(ndx, ndx) +=
           workspace.cstr_vector_hessian_prod[i];
     }
-    if (kkt_system_ == KKT_PRIMAL_DUAL) {
-      // correct lower right corner in primal-dual case
-      int idx = problem_->getIndex(i);
-      int nr = problem_->getConstraintDim(i);
+  }
+  if (kkt_system_ == KKT_PRIMAL_DUAL) {
+    // correct lower right corner in primal-dual case
+    for (std::size_t k = 0; k < workspace.batches.size(); k++) {
+      const auto &batch = workspace.batches[k];
+      const int idx = batch.index;
+      const int nr = batch.dim;
       auto d_sub = lower_right_block.diagonal().segment(idx, nr);
-      VectorXs d_sub2(d_sub);
-      // apply normal cone jacobian op
-      cstr_set.applyNormalConeProjectionJacobian(workspace.shift_cstr_pdal[i],
-                                                 d_sub2);
-      d_sub = 0.5 * (d_sub + d_sub2);
+      if (batch.diagonal) {
+        d_sub = mask.segment(idx, nr).select(d_sub, 0.5 * d_sub);
+        continue;
+      }
+      // the block is -mu * I: apply the (dense) normal cone Jacobian in place
+      // to get -mu * (I + N) / 2
+      auto blk = lower_right_block.block(idx, idx, nr, nr);
+      batch.set->applyNormalConeProjectionJacobian(
+          workspace.data_shift_cstr_pdal.segment(idx, nr), blk);
+      blk *= 0.5;
+      blk.diagonal().array() -= 0.5 * mu_;
     }
   }
 }
@@ -535,14 +684,21 @@ void ProxNLPSolverTpl<Scalar>::setPenalty(const Scalar &new_mu) noexcept {
     const ConstraintObject &cstr = problem_->getConstraint(i);
     cstr.set_->setProxParameter(mu_);
   }
+  if (workspace_) {
+    for (const auto &batch : workspace_->batches)
+      batch.set->setProxParameter(mu_);
+  }
+  for (const auto &ws : trial_workspaces_) {
+    for (const auto &batch : ws->batches)
+      batch.set->setProxParameter(mu_);
+  }
 }
 
 template <typename Scalar>
 void ProxNLPSolverTpl<Scalar>::setProxParameter(
     const Scalar &new_rho) noexcept {
   rho_ = new_rho;
-  prox_penalty.weights_.setZero();
-  prox_penalty.weights_.diagonal().setConstant(rho_);
+  prox_penalty.setWeight(rho_);
 }
 
 template <typename Scalar>
@@ -565,6 +721,27 @@ void ProxNLPSolverTpl<Scalar>::tolerancePostUpdate() noexcept {
   prim_tol_ = std::max(prim_tol_, target_tol);
 }
 
+template <typename Scalar>
+void ProxNLPSolverTpl<Scalar>::checkJacobianColumns(
+    const Workspace &workspace) const {
+  std::size_t b = 0;
+  for (std::size_t i = 0; i < problem_->getNumConstraints(); i++) {
+    if (problem_->getConstraintDim(i) == 0)
+      continue;
+    const int index = problem_->getIndex(i);
+    while ((b < workspace.batches.size()) &&
+           (index >= workspace.batches[b].index + workspace.batches[b].dim))
+      b++;
+    const auto &func = problem_->getConstraint(i).func();
+    if ((b == workspace.batches.size()) ||
+        (workspace.batches[b].col_start != func.jacobianColStart()) ||
+        (workspace.batches[b].col_size != func.jacobianColSize()))
+      PROXSUITE_NLP_RUNTIME_ERROR(
+          "The Jacobian column blocks of the constraints changed after "
+          "setup(): call setup() again.");
+  }
+}
+
 template <typename Scalar>
 void ProxNLPSolverTpl<Scalar>::tryStep(Workspace &workspace,
                                        const Results &results, Scalar alpha) {
@@ -576,5 +753,142 @@ void ProxNLPSolverTpl<Scalar>::tryStep(Workspace &workspace,
       results.data_lams_opt + alpha * workspace.dual_step;
   PROXSUITE_NLP_NOMALLOC_END;
 }
+
+template <typename Scalar>
+template <typename Fn>
+bool ProxNLPSolverTpl<Scalar>::trustRegionStep(Workspace &workspace, Fn &&phi,
+                                               const Scalar phi0,
+                                               const Scalar delta,
+                                               Scalar &phi_new) {
+  const long ndx = workspace.ndx;
+  const VectorXs &mg = workspace.merit_gradient;
+  const VectorXs &mdg = workspace.merit_dual_gradient;
+  workspace.tr_newton_step = workspace.pd_step;
+  const auto newton_prim = workspace.tr_newton_step.head(ndx);
+  const auto newton_dual = workspace.tr_newton_step.tail(workspace.numdual);
+
+  // The trust region uses the diagonal metric M = diag(w, mu), where w is the
+  // diagonal of the primal Hessian of the AL: the steepest descent direction
+  // is c = -M^{-1} g. Its curvature is estimated from the primal block of the
+  // KKT matrix (with its regularization), the AL term J^T J / mu over the
+  // active constraints, and the weight of the dual proximal term.
+  const ActiveType &mask = kkt_system_ == KKT_CLASSIC
+                               ? workspace.data_active_set
+                               : workspace.data_active_set_pdal;
+  workspace.tr_active = mask.template cast<Scalar>();
+  VectorXs &w = workspace.tr_scaling;
+  w.noalias() =
+      workspace.data_jacobians.cwiseAbs2().transpose() * workspace.tr_active;
+  w = mu_inv_ * w +
+      workspace.kkt_matrix.diagonal().head(ndx).cwiseAbs() +
+      VectorXs::Constant(ndx, delta);
+  w = w.cwiseMax(std::numeric_limits<Scalar>::epsilon());
+  auto cauchy_prim = workspace.tr_cauchy_step.head(ndx);
+  auto cauchy_dual = workspace.tr_cauchy_step.tail(workspace.numdual);
+  cauchy_prim = mg.cwiseQuotient(w);
+  cauchy_dual = mu_inv_ * mdg;
+  workspace.tr_hess_grad.noalias() =
+      workspace.kkt_matrix.topLeftCorner(ndx, ndx) * cauchy_prim;
+  workspace.tr_jac_grad.noalias() = workspace.data_jacobians * cauchy_prim;
+  const Scalar gBg =
+      cauchy_prim.dot(workspace.tr_hess_grad) +
+      delta * cauchy_prim.squaredNorm() +
+      mu_inv_ * workspace.tr_jac_grad.cwiseProduct(workspace.tr_active)
+                    .squaredNorm() +
+      pdal_beta_ * mu_ * cauchy_dual.squaredNorm();
+  const DoglegTpl<Scalar> dogleg(
+      mg.dot(cauchy_prim) + mdg.dot(cauchy_dual), workspace.dmerit_dir,
+      newton_prim.dot(w.cwiseProduct(newton_prim)) +
+          mu_ * newton_dual.squaredNorm(),
+      gBg);
+
+  Scalar &radius = workspace.tr_radius;
+  Scalar u, v;
+  for (std::size_t k = 0; k < tr_params.max_trials; k++) {
+    dogleg.compute(radius, u, v);
+    workspace.pd_step = v * workspace.tr_newton_step -
+                        u * workspace.tr_cauchy_step;
+    const Scalar pred = -dogleg.model(u, v);
+    const Scalar step_norm = dogleg.norm(u, v);
+    const Scalar phi_trial = phi(1.);
+    if (pred <= std::abs(phi0) * std::numeric_limits<Scalar>::epsilon()) {
+      // no decrease left to predict: only accept an actual decrease
+      if (!Linesearch<Scalar>::isValid(phi_trial) || !(phi_trial < phi0))
+        return false;
+      phi_new = phi_trial;
+      return true;
+    }
+    // the ratio is not finite, hence the step rejected, if phi_trial is not
+    const Scalar ratio = (phi0 - phi_trial) / pred;
+    if (ratio >= tr_params.eta_accept) {
+      if (ratio >= tr_params.eta_expand)
+        radius = std::min(std::max(radius, tr_params.expand_factor * step_norm),
+                          tr_params.radius_max);
+      else if (ratio < tr_params.eta_shrink)
+        radius = std::max(tr_params.shrink_factor * step_norm,
+                          tr_params.radius_min);
+      phi_new = phi_trial;
+      return true;
+    }
+    radius = tr_params.shrink_factor * std::min(radius, step_norm);
+    if (radius < tr_params.radius_min) {
+      radius = tr_params.radius_min;
+      return false;
+    }
+  }
+  return false;
+}
+
+template <typename Scalar> void ProxNLPSolverTpl<Scalar>::allocateTrials() {
+  const std::size_t m = std::max(ls_options.parallel_trials, std::size_t(1));
+  // the first trial runs on the main workspace, and on the calling thread
+  trial_workspaces_.clear();
+  for (std::size_t k = 1; k < m; k++) {
+    trial_workspaces_.push_back(std::make_unique<Workspace>(*problem_));
+  }
+  thread_pool_ = m > 1 ? std::make_unique<ThreadPool>(m - 1) : nullptr;
+}
+
+template <typename Scalar>
+void ProxNLPSolverTpl<Scalar>::evaluateTrials(const Results &results,
+                                              const std::vector<Scalar> &alphas,
+                                              std::vector<Scalar> &values) {
+  Workspace &workspace = *workspace_;
+  const std::size_t m = alphas.size();
+  assert(m <= trial_workspaces_.size() + 1);
+  values.resize(m);
+  auto get_workspace = [&](std::size_t k) -> Workspace & {
+    return k == 0 ? workspace : *trial_workspaces_[k - 1];
+  };
+  for (std::size_t k = 1; k < m; k++) {
+    Workspace &ws = get_workspace(k);
+    ws.pd_step = workspace.pd_step;
+    ws.data_lams_prev = workspace.data_lams_prev;
+  }
+
+  auto trial = [&](std::size_t k) {
+    Workspace &ws = get_workspace(k);
+    try {
+      tryStep(ws, results, alphas[k]);
+      ws.objective_value = problem_->cost().call(ws.x_trial);
+      problem_->evaluateConstraints(ws.x_trial, ws);
+      computeMultipliers(ws.data_lams_trial, ws);
+      values[k] = merit_fun.evaluate(ws.x_trial, ws.lams_trial, ws);
+    } catch (const std::runtime_error &) {
+      values[k] = std::numeric_limits<Scalar>::infinity();
+    }
+  };
+  if (thread_pool_ && problem_->isThreadSafe()) {
+    thread_pool_->run(m, trial);
+  } else {
+    for (std::size_t k = 0; k < m; k++)
+      trial(k);
+  }
+  // the proximal penalty also caches its residual
+  for (std::size_t k = 0; k < m; k++) {
+    if (std::isfinite(values[k]))
+      values[k] += prox_penalty.call(get_workspace(k).x_trial);
+  }
+}
 } // namespace nlp
 } // namespace proxsuite
@@ -0,0 +1,108 @@
+/// @file proximal-penalty.hpp
+/// @copyright Copyright (C) 2026 LAAS-CNRS, INRIA
+/// @brief  Primal proximal penalty of the solver.
+#pragma once
+
+#include "proxsuite-nlp/manifold-base.hpp"
+#include "proxsuite-nlp/third-party/polymorphic_cxx14.hpp"
+
+#include <vector>
+
+namespace proxsuite {
+namespace nlp {
+
+/// @brief  Proximal penalty \f$\frac{\rho}{2}\|x\ominus\bar{x}\|^2\f$ around
+/// the previous outer iterate \f$\bar{x}\f$.
+/// @details Its weight matrix is the scaled identity \f$\rho I\f$, so the
+/// derivatives only involve the Jacobian \f$J\f$ of the manifold difference:
+/// the gradient is \f$\rho J^\top(x\ominus\bar{x})\f$ and the Gauss-Newton
+/// Hessian \f$\rho J^\top J\f$, which is a diagonal shift on vector spaces and
+/// is assembled block by block for block-diagonal Jacobians (see
+/// JacobianStructure).
+template <typename _Scalar> struct ProximalPenaltyTpl {
+  using Scalar = _Scalar;
+  PROXSUITE_NLP_DYNAMIC_TYPEDEFS(Scalar);
+  using Manifold = ManifoldAbstractTpl<Scalar>;
+
+  ProximalPenaltyTpl(const polymorphic<Manifold> &space,
+                     const ConstVectorRef &target, const Scalar rho)
+      : space_(space), target_(target), rho_(rho),
+        structure_(space->jacobianStructure()), block_offsets_{0},
+        err_(space->ndx()), Jdiff_(space->ndx(), space->ndx()) {
+    for (int n : space->jacobianBlocks())
+      block_offsets_.push_back(block_offsets_.back() + n);
+    err_.setZero();
+    Jdiff_.setZero();
+  }
+
+  Scalar weight() const { return rho_; }
+  void setWeight(const Scalar rho) noexcept { rho_ = rho; }
+
+  ConstVectorRef getTarget() const { return target_; }
+  void updateTarget(const ConstVectorRef &x) { target_ = x; }
+
+  /// Evaluate the penalty, caching the difference \f$x\ominus\bar{x}\f$.
+  Scalar call(const ConstVectorRef &x) const {
+    space_->difference(target_, x, err_);
+    return Scalar(0.5) * rho_ * err_.squaredNorm();
+  }
+
+  /// Gradient at the point @p x of the last call(). This also caches the
+  /// Jacobian of the difference, used by addHessian().
+  void computeGradient(const ConstVectorRef &x, VectorRef out) const {
+    if (structure_ == JacobianStructure::IDENTITY) {
+      out = rho_ * err_;
+      return;
+    }
+    space_->Jdifference(target_, x, Jdiff_, 1);
+    if (structure_ == JacobianStructure::BLOCK_DIAGONAL) {
+      for (std::size_t i = 0; i + 1 < block_offsets_.size(); i++) {
+        const int c = block_offsets_[i], n = block_offsets_[i + 1] - c;
+        out.segment(c, n).noalias() =
+            rho_ * Jdiff_.block(c, c, n, n).transpose() * err_.segment(c, n);
+      }
+    } else {
+      out.noalias() = rho_ * Jdiff_.transpose() * err_;
+    }
+  }
+
+  /// Add the Gauss-Newton Hessian at the point of the last computeGradient()
+  /// call to @p H, without touching the entries where it is zero.
+  void addHessian(MatrixRef H) const {
+    switch (structure_) {
+    case JacobianStructure::IDENTITY:
+      H.diagonal().array() += rho_;
+      break;
+    case JacobianStructure::BLOCK_DIAGONAL:
+      for (std::size_t i = 0; i + 1 < block_offsets_.size(); i++) {
+        const int c = block_offsets_[i], n = block_offsets_[i + 1] - c;
+        H.block(c, c, n, n).noalias() += rho_ *
+                                         Jdiff_.block(c, c, n, n).transpose() *
+                                         Jdiff_.block(c, c, n, n);
+      }
+      break;
+    default:
+      H.noalias() += rho_ * Jdiff_.transpose() * Jdiff_;
+      break;
+    }
+  }
+
+  /// Gauss-Newton Hessian at the point of the last computeGradient() call.
+  void computeHessian(MatrixRef out) const {
+    out.setZero();
+    addHessian(out);
+  }
+
+protected:
+  polymorphic<Manifold> space_;
+  VectorXs target_;
+  Scalar rho_;
+  JacobianStructure structure_;
+  /// Offsets of the diagonal blocks of the difference Jacobian.
+  std::vector<int> block_offsets_;
+  mutable VectorXs err_;
+  mutable MatrixXs Jdiff_;
+};
+
+} // namespace nlp
+} // namespace proxsuite
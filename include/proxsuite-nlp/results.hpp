@@ -8,7 +8,14 @@
 namespace proxsuite {
 namespace nlp {
 
-enum ConvergenceFlag { UNINIT = -1, SUCCESS = 0, MAX_ITERS_REACHED = 1 };
+/// TRUST_REGION_FAILURE: no acceptable step was found within the trust
+/// region (see TrustRegionParamsTpl::radius_min).
+enum ConvergenceFlag {
+  UNINIT = -1,
+  SUCCESS = 0,
+  MAX_ITERS_REACHED = 1,
+  TRUST_REGION_FAILURE = 2
+};
 inline auto format_as(ConvergenceFlag fl) { return fmt::underlying(fl); }
 
 /**
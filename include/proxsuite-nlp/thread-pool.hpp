@@ -0,0 +1,123 @@
+/// @file
+/// @copyright Copyright (C) 2026 LAAS-CNRS, INRIA
+/// @brief     A fixed-size pool of worker threads.
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace proxsuite {
+namespace nlp {
+
+/// @brief  Persistent worker threads running batches of indexed tasks.
+/// @details The workers are started by the constructor and joined by the
+/// destructor: run() only hands out task indices, so that a batch does not
+/// spawn any thread.
+class ThreadPool {
+public:
+  using Task = std::function<void(std::size_t)>;
+
+  explicit ThreadPool(const std::size_t num_workers) {
+    workers_.reserve(num_workers);
+    for (std::size_t i = 0; i < num_workers; i++)
+      workers_.emplace_back([this] { workerLoop(); });
+  }
+
+  ThreadPool(const ThreadPool &) = delete;
+  ThreadPool &operator=(const ThreadPool &) = delete;
+
+  ~ThreadPool() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stop_ = true;
+    }
+    cv_task_.notify_all();
+    for (std::thread &w : workers_)
+      w.join();
+  }
+
+  std::size_t numWorkers() const { return workers_.size(); }
+
+  /// @brief Call @p task(k) for \f$k = 0,\ldots,n-1\f$ and wait for all the
+  /// calls to return.
+  /// @details The calling thread runs task 0 and takes part in the others.
+  /// The first exception thrown by a task is rethrown once all tasks are done.
+  void run(const std::size_t n, const Task &task) {
+    if (n == 0)
+      return;
+    std::unique_lock<std::mutex> lock(mutex_);
+    task_ = &task;
+    next_ = 1;
+    num_tasks_ = n;
+    pending_ = n;
+    error_ = nullptr;
+    lock.unlock();
+    cv_task_.notify_all();
+
+    execute(task, 0, lock);
+    while (next_ < num_tasks_) {
+      const std::size_t k = next_++;
+      lock.unlock();
+      execute(task, k, lock);
+    }
+    cv_done_.wait(lock, [this] { return pending_ == 0; });
+    task_ = nullptr;
+    std::exception_ptr error = error_;
+    error_ = nullptr;
+    lock.unlock();
+    if (error)
+      std::rethrow_exception(error);
+  }
+
+private:
+  /// Run task @p k with the lock released, then reacquire it and mark the
+  /// task as done.
+  void execute(const Task &task, const std::size_t k,
+               std::unique_lock<std::mutex> &lock) {
+    std::exception_ptr error;
+    try {
+      task(k);
+    } catch (...) {
+      error = std::current_exception();
+    }
+    lock.lock();
+    if (error && !error_)
+      error_ = error;
+    if (--pending_ == 0)
+      cv_done_.notify_all();
+  }
+
+  void workerLoop() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+      cv_task_.wait(lock, [this] {
+        return stop_ || ((task_ != nullptr) && (next_ < num_tasks_));
+      });
+      if (stop_)
+        return;
+      const Task &task = *task_;
+      const std::size_t k = next_++;
+      lock.unlock();
+      execute(task, k, lock);
+    }
+  }
+
+  std::vector<std::thread> workers_;
+  std::mutex mutex_;
+  std::condition_variable cv_task_;
+  std::condition_variable cv_done_;
+  const Task *task_ = nullptr;
+  std::size_t next_ = 0;
+  std::size_t num_tasks_ = 0;
+  std::size_t pending_ = 0;
+  std::exception_ptr error_;
+  bool stop_ = false;
+};
+
+} // namespace nlp
+} // namespace proxsuite
@@ -0,0 +1,115 @@
+/// @file trust-region.hpp
+/// @copyright Copyright (C) 2026 LAAS-CNRS, INRIA
+/// @brief  Trust-region globalization of the Newton steps.
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
+namespace proxsuite {
+namespace nlp {
+
+/// Globalization of the inner Newton iterations.
+enum class GlobalizationStrategy {
+  /// Linesearch on the merit function (see LinesearchStrategy).
+  LINESEARCH,
+  /// Dogleg steps within a trust region, see DoglegTpl.
+  TRUST_REGION
+};
+
+template <typename Scalar> struct TrustRegionParamsTpl {
+  /// Initial trust-region radius, at the start of each inner loop; the default
+  /// lets the first Newton step be tried in full.
+  Scalar radius_init = 1e4;
+  /// Minimum radius: once the radius falls below it, the step is rejected
+  /// and the solve stops at the current iterate, with
+  /// ConvergenceFlag::TRUST_REGION_FAILURE.
+  Scalar radius_min = 1e-10;
+  /// Maximum radius.
+  Scalar radius_max = 1e8;
+  /// Minimum ratio of actual to predicted merit decrease to accept a step.
+  Scalar eta_accept = 1e-4;
+  /// Ratio below which the radius is shrunk, even if the step is accepted.
+  Scalar eta_shrink = 0.25;
+  /// Ratio above which the radius is expanded.
+  Scalar eta_expand = 0.75;
+  /// Radius contraction factor on rejected steps.
+  Scalar shrink_factor = 0.25;
+  /// Radius expansion factor, relative to the norm of the accepted step.
+  Scalar expand_factor = 3.;
+  /// Maximum number of trial steps per iteration, after which the step is
+  /// rejected as for radius_min.
+  std::size_t max_trials = 20;
+};
+
+/// @brief  Dogleg path on the plane spanned by the merit gradient \f$g\f$ and
+/// the Newton step \f$d\f$ computed from the KKT factorization.
+/// @details The trust region is measured in a metric
+/// \f$\|p\|_M^2 = p^\top Mp\f$. Steps are represented by their coordinates
+/// \f$p = -uM^{-1}g + vd\f$, so that the path is computed from inner products
+/// only. The model is \f$ m(p) = g^\top p + \frac12 p^\top B p \f$, where
+/// \f$B\f$ is consistent with the Newton step (\f$Bd = -g\f$ on the plane)
+/// and the curvature along the steepest descent step is given by the caller,
+/// e.g. from the primal block of the KKT matrix.
+template <typename Scalar> struct DoglegTpl {
+  /// \f$ g^\top M^{-1} g \f$
+  Scalar gg;
+  /// \f$ g^\top d \f$, negative if \f$d\f$ is a descent direction.
+  Scalar gd;
+  /// \f$ d^\top Md \f$
+  Scalar dd;
+  /// \f$ g^\top M^{-1}BM^{-1}g \f$
+  Scalar gBg;
+
+  DoglegTpl(Scalar gg, Scalar gd, Scalar dd, Scalar gBg)
+      : gg(gg), gd(gd), dd(dd), gBg(gBg) {
+    // keep the model positive semidefinite on the plane
+    if (newtonIsDescent())
+      this->gBg = std::max(this->gBg, gg * gg / (-gd));
+  }
+
+  bool newtonIsDescent() const { return gd < 0.; }
+
+  Scalar norm(const Scalar u, const Scalar v) const {
+    return std::sqrt(std::max(u * u * gg - 2. * u * v * gd + v * v * dd, 0.));
+  }
+
+  /// Model value \f$m(-uM^{-1}g + vd)\f$.
+  Scalar model(const Scalar u, const Scalar v) const {
+    Scalar m = -u * gg + 0.5 * u * u * gBg;
+    if (newtonIsDescent())
+      m += v * gd + u * v * gg - 0.5 * v * v * gd;
+    return m;
+  }
+
+  /// Coordinates of the dogleg step for the trust-region @p radius.
+  void compute(const Scalar radius, Scalar &u, Scalar &v) const {
+    u = 0.;
+    v = 0.;
+    if (newtonIsDescent() && (dd <= radius * radius)) {
+      v = 1.;
+      return;
+    }
+    if (gg <= 0.)
+      return;
+    const Scalar gnorm = std::sqrt(gg);
+    // Cauchy point: model minimizer along the steepest descent direction
+    const Scalar t = gBg > 0. ? gg / gBg : radius / gnorm;
+    if (!newtonIsDescent() || (t * gnorm >= radius)) {
+      u = std::min(t, radius / gnorm);
+      return;
+    }
+    // intersect the segment from the Cauchy point to d with the boundary
+    const Scalar cc = t * t * gg;
+    const Scalar cw = -t * gd - cc;
+    const Scalar ww = dd + 2. * t * gd + cc;
+    const Scalar disc = std::max(cw * cw - ww * (cc - radius * radius), 0.);
+    const Scalar s = ww > 0. ? (-cw + std::sqrt(disc)) / ww : 1.;
+    u = t * (1. - s);
+    v = s;
+  }
+};
+
+} // namespace nlp
+} // namespace proxsuite
@@ -4,6 +4,7 @@
 
 #include "proxsuite-nlp/problem-base.hpp"
 #include "proxsuite-nlp/ldlt-allocator.hpp"
+#include "proxsuite-nlp/linesearch-base.hpp"
 
 #include <fmt/ostream.h>
 
@@ -28,6 +29,8 @@ public:
 
   PROXSUITE_NLP_DYNAMIC_TYPEDEFS(Scalar);
   using Problem = ProblemTpl<Scalar>;
+  using ConstraintSet = ConstraintSetTpl<Scalar>;
+  using ActiveType = typename ConstraintSet::ActiveType;
 
   /// Newton iteration variables
 
@@ -64,7 +67,6 @@ public:
   VectorOfRef lams_trial;
 
   VectorXs prox_grad;
-  MatrixXs prox_hess;
 
   /// Residuals
 
@@ -87,7 +89,15 @@ public:
   VectorXs merit_dual_gradient;
 
   MatrixXs data_jacobians;
+  /// Stacked multiplier vectors \f$[\lambda, \Lambda, \lambda_{pdal}]\f$
+  /// multiplied by the transposed Jacobian in a single product.
+  MatrixXs jac_tr_rhs;
+  /// Result of the product of the transposed Jacobian with #jac_tr_rhs.
+  MatrixXs jac_tr_prod;
   MatrixXs data_hessians;
+  /// Projected constraint Jacobians. Only the rows of constraint sets without
+  /// a diagonal projection Jacobian are filled; the others are applied by the
+  /// solver as a mask on #data_jacobians.
   MatrixXs data_jacobians_proj;
   std::vector<MatrixRef> cstr_jacobians;
   std::vector<MatrixRef> cstr_vector_hessian_prod;
@@ -99,6 +109,9 @@ public:
   VectorXs data_lams_pdal;
   VectorXs data_lams_pdal_reproj;
   VectorXs data_shift_cstr_pdal;
+  /// Scratch buffer for the merit function: proximal point of the primal-dual
+  /// shifted constraints.
+  VectorXs data_prox_pdal;
 
   /// First-order multipliers \f$\mathrm{proj}(\lambda_e + c / \mu)\f$
   std::vector<VectorRef> lams_plus;
@@ -110,6 +123,29 @@ public:
   std::vector<VectorRef> lams_pdal;
   std::vector<VectorRef> lams_pdal_reproj;
   std::vector<VectorRef> shift_cstr_pdal;
+  /// Active set at the shifted constraint values
+  ActiveType data_active_set;
+  /// Active set at the primal-dual shifted constraint values
+  ActiveType data_active_set_pdal;
+
+  /// @brief Contiguous constraint blocks of the same type, whose sets are
+  /// merged so that the projection operators are called once per batch (see
+  /// ConstraintSetTpl::tryMerge()).
+  /// @details The data read by the solver's per-batch loops is grouped in a
+  /// single record. The merged set is a separate heap-allocated copy of the
+  /// sets of the problem, see updateBatches().
+  struct ConstraintBatch {
+    polymorphic<ConstraintSet> set;
+    /// Start index in the stacked constraint vector.
+    int index;
+    int dim;
+    /// Nonzero Jacobian column block.
+    int col_start;
+    int col_size;
+    /// Cached ConstraintSetTpl::hasDiagonalProjectionJacobian().
+    bool diagonal;
+  };
+  std::vector<ConstraintBatch> batches;
 
   std::vector<Scalar> ls_alphas;
   std::vector<Scalar> ls_values;
@@ -117,8 +153,28 @@ public:
   Scalar alpha_opt;
   /// Merit function derivative in descent direction
   Scalar dmerit_dir = 0.;
+  /// Past merit values of the inner loop, for the nonmonotone linesearch
+  NonmonotoneReference<Scalar> merit_history;
+
+  /// Trust-region radius
+  Scalar tr_radius = 1.;
+  /// Newton step kept by the trust-region globalization
+  VectorXs tr_newton_step;
+  /// Steepest descent step of the trust-region globalization
+  VectorXs tr_cauchy_step;
+  /// Diagonal scaling of the trust region (primal part)
+  VectorXs tr_scaling;
+  /// Active set mask, as scalars
+  VectorXs tr_active;
+  /// Products of the primal KKT block and of the constraint Jacobian with the
+  /// primal steepest descent step
+  VectorXs tr_hess_grad;
+  VectorXs tr_jac_grad;
 
   VectorXs tmp_dx_scaled;
+  /// Primal step transported to the trial point, for the derivative of the
+  /// merit function along the step.
+  VectorXs tmp_dx_transported;
 
   WorkspaceTpl(const Problem &prob, LDLTChoice ldlt_choice = LDLTChoice::DENSE)
       : nx(long(prob.nx())), ndx(long(prob.ndx())),
@@ -130,13 +186,18 @@ public:
         signature(ndx + numdual),
         ldlt_(allocate_ldlt_from_problem(prob, ldlt_choice)), x_prev(nx),
         x_trial(nx), data_lams_prev(numdual), data_lams_trial(numdual),
-        prox_grad(ndx), prox_hess(ndx, ndx), dual_residual(ndx),
+        prox_grad(ndx), dual_residual(ndx),
         data_cstr_values(numdual), objective_gradient(ndx),
         objective_hessian(ndx, ndx), merit_gradient(ndx),
         merit_dual_gradient(numdual), data_jacobians(numdual, ndx),
+        jac_tr_rhs(numdual, 3), jac_tr_prod(ndx, 3),
         data_hessians((long)numblocks * ndx, ndx), data_lams_plus(numdual),
         data_lams_plus_reproj(numdual), data_lams_pdal(numdual),
-        tmp_dx_scaled(ndx) {
+        data_prox_pdal(numdual), data_active_set(numdual),
+        data_active_set_pdal(numdual),
+        tr_newton_step(ndx + numdual), tr_cauchy_step(ndx + numdual),
+        tr_scaling(ndx), tr_active(numdual), tr_hess_grad(ndx),
+        tr_jac_grad(numdual), tmp_dx_scaled(ndx), tmp_dx_transported(ndx) {
     init(prob);
   }
 
@@ -152,7 +213,6 @@ public:
     helpers::allocateMultipliersOrResiduals(prob, data_lams_prev, lams_prev);
     helpers::allocateMultipliersOrResiduals(prob, data_lams_trial, lams_trial);
     prox_grad.setZero();
-    prox_hess.setZero();
 
     dual_residual.setZero();
     helpers::allocateMultipliersOrResiduals(
@@ -163,6 +223,8 @@ public:
     merit_gradient.setZero();
     merit_dual_gradient.setZero();
     data_jacobians.setZero();
+    jac_tr_rhs.setZero();
+    jac_tr_prod.setZero();
     data_hessians.setZero();
 
     helpers::allocateMultipliersOrResiduals(prob, data_shift_cstr_values,
@@ -175,7 +237,17 @@ public:
                                             lams_pdal_reproj);
     helpers::allocateMultipliersOrResiduals(prob, data_shift_cstr_pdal,
                                             shift_cstr_pdal);
+    data_prox_pdal.setZero();
+    data_active_set.setZero();
+    data_active_set_pdal.setZero();
+    tr_newton_step.setZero();
+    tr_cauchy_step.setZero();
+    tr_scaling.setZero();
+    tr_active.setZero();
+    tr_hess_grad.setZero();
+    tr_jac_grad.setZero();
     tmp_dx_scaled.setZero();
+    tmp_dx_transported.setZero();
 
     cstr_jacobians.reserve(numblocks);
     cstr_vector_hessian_prod.reserve(numblocks);
@@ -193,6 +265,35 @@ public:
       cstr_vector_hessian_prod.emplace_back(
           data_hessians.middleRows((int)i * ndx, ndx));
     }
+
+    updateBatches(prob);
+  }
+
+  /// @brief Rebuild the constraint #batches from the current constraint sets
+  /// of the problem.
+  /// @details The batches hold merged copies of the sets: this is called by
+  /// the solver at the start of each solve, so that changes to the sets of
+  /// the problem (e.g. new bounds) are taken into account.
+  void updateBatches(const Problem &prob) {
+    batches.clear();
+    batches.reserve(numblocks);
+    for (std::size_t i = 0; i < numblocks; i++) {
+      const auto &cstr = prob.getConstraint(i);
+      const int c0 = cstr.func().jacobianColStart();
+      const int nc = cstr.func().jacobianColSize();
+      const int nr = prob.getConstraintDim(i);
+      // only merge blocks which share their Jacobian sparsity
+      if (!batches.empty() && (batches.back().col_start == c0) &&
+          (batches.back().col_size == nc) &&
+          batches.back().set->tryMerge(*cstr.set_)) {
+        batches.back().dim += nr;
+      } else {
+        batches.push_back({cstr.set_, prob.getIndex(i), nr, c0, nc, false});
+      }
+    }
+    for (auto &batch : batches) {
+      batch.diagonal = batch.set->hasDiagonalProjectionJacobian();
+    }
   }
 };
 
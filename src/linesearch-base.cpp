@@ -4,5 +4,7 @@ namespace proxsuite {
 namespace nlp {
 template class PROXSUITE_NLP_EXPLICIT_INSTANTIATION_DEFINITION_DLLAPI
     Linesearch<context::Scalar>;
+template class PROXSUITE_NLP_EXPLICIT_INSTANTIATION_DEFINITION_DLLAPI
+    NonmonotoneReference<context::Scalar>;
 } // namespace nlp
 } // namespace proxsuite
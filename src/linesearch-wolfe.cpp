@@ -0,0 +1,10 @@
+#include "proxsuite-nlp/linesearch-wolfe.hpp"
+
+namespace proxsuite {
+namespace nlp {
+
+template class PROXSUITE_NLP_EXPLICIT_INSTANTIATION_DEFINITION_DLLAPI
+    WolfeLinesearch<context::Scalar>;
+
+} // namespace nlp
+} // namespace proxsuite
@@ -0,0 +1,16 @@
+#include "proxsuite-nlp/modelling/residuals/multibody-residuals.hpp"
+
+namespace proxsuite {
+namespace nlp {
+
+template struct PROXSUITE_NLP_EXPLICIT_INSTANTIATION_DEFINITION_DLLAPI
+    MultibodyResidualBaseTpl<context::Scalar>;
+template struct PROXSUITE_NLP_EXPLICIT_INSTANTIATION_DEFINITION_DLLAPI
+    FramePlacementResidualTpl<context::Scalar>;
+template struct PROXSUITE_NLP_EXPLICIT_INSTANTIATION_DEFINITION_DLLAPI
+    FrameTranslationResidualTpl<context::Scalar>;
+template struct PROXSUITE_NLP_EXPLICIT_INSTANTIATION_DEFINITION_DLLAPI
+    CenterOfMassResidualTpl<context::Scalar>;
+
+} // namespace nlp
+} // namespace proxsuite
@@ -0,0 +1,60 @@
+#include "proxsuite-nlp/modelling/autodiff/autodiff-function.hpp"
+#include "proxsuite-nlp/modelling/autodiff/finite-difference.hpp"
+#include "proxsuite-nlp/modelling/spaces/vector-space.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+#include "proxsuite-nlp/fmt-eigen.hpp"
+
+BOOST_AUTO_TEST_SUITE(autodiff_function)
+
+using namespace proxsuite::nlp;
+
+PROXSUITE_NLP_DYNAMIC_TYPEDEFS(double);
+
+struct MyFunctor {
+  template <typename T>
+  Eigen::Matrix<T, -1, 1> operator()(const Eigen::Matrix<T, -1, 1> &x) const {
+    using std::sin;
+    Eigen::Matrix<T, -1, 1> out(3);
+    out(0) = x(0) * x(1) + sin(x(2));
+    out(1) = x(0) * x(0) * x(2) - T(3.);
+    out(2) = T(1.);
+    return out;
+  }
+};
+
+BOOST_AUTO_TEST_CASE(jacobian_vhp) {
+  const int nx = 3;
+  VectorSpaceTpl<double> space(nx);
+  auto fun = autodiff::makeAutoDiffFunction<double>(nx, 3, MyFunctor{});
+  VectorXs x0 = space.rand();
+
+  MatrixXs J0(3, nx);
+  fun->computeJacobian(x0, J0);
+  MatrixXs Jref(3, nx);
+  Jref << x0(1), x0(0), std::cos(x0(2)), //
+      2. * x0(0) * x0(2), 0., x0(0) * x0(0), //
+      0., 0., 0.;
+  fmt::print("J0:\n{}\n", J0);
+  BOOST_CHECK(J0.isApprox(Jref));
+  BOOST_CHECK(fun->operator()(x0).isApprox(MyFunctor{}(x0)));
+
+  VectorXs v0 = VectorXs::Random(3);
+  MatrixXs H0(nx, nx);
+  fun->vectorHessianProduct(x0, v0, H0);
+  MatrixXs Href(nx, nx);
+  Href << 2. * v0(1) * x0(2), v0(0), 2. * v0(1) * x0(0), //
+      v0(0), 0., 0.,                                    //
+      2. * v0(1) * x0(0), 0., -v0(0) * std::sin(x0(2));
+  fmt::print("H0:\n{}\n", H0);
+  BOOST_CHECK(H0.isApprox(Href));
+
+  autodiff::finite_difference_wrapper<double, autodiff::TOC2> fdfun(space, *fun,
+                                                                    1e-6);
+  MatrixXs Hfd(nx, nx);
+  fdfun.vectorHessianProduct(x0, v0, Hfd);
+  BOOST_CHECK(H0.isApprox(Hfd, 1e-4));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -4,6 +4,7 @@
 
 #include "proxsuite-nlp/fmt-eigen.hpp"
 
+#include <Eigen/Eigenvalues>
 #include <boost/test/unit_test.hpp>
 
 BOOST_AUTO_TEST_SUITE(constraint)
@@ -49,4 +50,177 @@ BOOST_AUTO_TEST_CASE(constraint_product_op) {
   BOOST_CHECK(z.isApprox(zCopy));
 }
 
+BOOST_AUTO_TEST_CASE(product_batches) {
+  using Set = xyz::polymorphic<ConstraintSetTpl<double>>;
+  EqualityConstraintTpl<double> eq_op;
+  NegativeOrthantTpl<double> neg_op;
+  BoxConstraintTpl<double> box_op(-VectorXs::Ones(2), VectorXs::Ones(2));
+  eq_op.setProxParameter(0.1);
+  neg_op.setProxParameter(0.1);
+  box_op.setProxParameter(0.1);
+  std::vector<Set> comps{eq_op, eq_op, neg_op, neg_op, neg_op, box_op, box_op};
+  std::vector<Eigen::Index> sizes{1, 2, 3, 1, 2, 2, 2};
+  ConstraintSetProductTpl<double> op(comps, sizes);
+  BOOST_CHECK_EQUAL(op.numBatches(), 3);
+  BOOST_CHECK_EQUAL(op.blockOffsets().size(), sizes.size() + 1);
+  BOOST_CHECK_EQUAL(op.blockOffsets()[3], 6);
+  BOOST_CHECK_EQUAL(op.blockOffsets().back(), 13);
+
+  const long n = 13;
+  VectorXs z = 2 * VectorXs::Random(n);
+  VectorXs zout(n), zout_ref(n);
+  MatrixXs J = MatrixXs::Random(n, 4);
+  MatrixXs J_ref = J;
+  op.normalConeProjection(z, zout);
+  op.applyNormalConeProjectionJacobian(z, J);
+  for (std::size_t i = 0; i < comps.size(); i++) {
+    auto zi = blockVectorGetRow(z, sizes, i);
+    comps[i]->normalConeProjection(zi, blockVectorGetRow(zout_ref, sizes, i));
+    comps[i]->applyNormalConeProjectionJacobian(
+        zi, blockMatrixGetRow(J_ref, sizes, i));
+  }
+  BOOST_CHECK(zout.isApprox(zout_ref));
+  BOOST_CHECK(J.isApprox(J_ref));
+}
+
+BOOST_AUTO_TEST_CASE(merge_sets) {
+  NegativeOrthantTpl<double> neg_op;
+  EqualityConstraintTpl<double> eq_op;
+  BOOST_CHECK(neg_op.tryMerge(NegativeOrthantTpl<double>{}));
+  BOOST_CHECK(!neg_op.tryMerge(eq_op));
+  BOOST_CHECK(!eq_op.tryMerge(neg_op));
+
+  long n1 = 2, n2 = 3;
+  VectorXs lb1 = -VectorXs::Random(n1).cwiseAbs();
+  VectorXs ub1 = VectorXs::Random(n1).cwiseAbs();
+  VectorXs lb2 = -VectorXs::Random(n2).cwiseAbs();
+  VectorXs ub2 = VectorXs::Random(n2).cwiseAbs();
+  BoxConstraintTpl<double> box1(lb1, ub1);
+  BoxConstraintTpl<double> box2(lb2, ub2);
+  BoxConstraintTpl<double> merged = box1;
+  BOOST_CHECK(!merged.tryMerge(neg_op));
+  BOOST_CHECK(merged.tryMerge(box2));
+  BOOST_CHECK_EQUAL(merged.lower_limit.size(), n1 + n2);
+
+  VectorXs z = 2 * VectorXs::Random(n1 + n2);
+  VectorXs zout(n1 + n2), zref(n1 + n2);
+  merged.normalConeProjection(z, zout);
+  box1.normalConeProjection(z.head(n1), zref.head(n1));
+  box2.normalConeProjection(z.tail(n2), zref.tail(n2));
+  BOOST_CHECK(zout.isApprox(zref));
+}
+
+/// Compare the fused kernel of a set with the default implementation.
+template <typename Set> void check_compute_all(const Set &set, long n) {
+  using Base = ConstraintSetTpl<double>;
+  using ActiveType = Base::ActiveType;
+  VectorXs z = 2 * VectorXs::Random(n);
+  VectorXs zpdal = 2 * VectorXs::Random(n);
+  MatrixXs out(n, 4), out_ref(n, 4);
+  ActiveType act(n), act_pdal(n), act_ref(n), act_pdal_ref(n);
+  set.computeAll(z, zpdal, out.col(0), out.col(1), out.col(2), out.col(3), act,
+                 act_pdal);
+  set.Base::computeAll(z, zpdal, out_ref.col(0), out_ref.col(1),
+                       out_ref.col(2), out_ref.col(3), act_ref, act_pdal_ref);
+  BOOST_CHECK(out.isApprox(out_ref));
+  BOOST_CHECK(act == act_ref);
+  BOOST_CHECK(act_pdal == act_pdal_ref);
+}
+
+BOOST_AUTO_TEST_CASE(compute_all) {
+  const long n = 6;
+  check_compute_all(EqualityConstraintTpl<double>{}, n);
+  check_compute_all(NegativeOrthantTpl<double>{}, n);
+  check_compute_all(BoxConstraintTpl<double>(-VectorXs::Ones(n),
+                                             0.5 * VectorXs::Ones(n)),
+                    n);
+  NonsmoothPenaltyL1Tpl<double> l1;
+  l1.setProxParameter(0.6);
+  check_compute_all(l1, n);
+  ConstraintSetProductTpl<double> prod(
+      {EqualityConstraintTpl<double>{}, NegativeOrthantTpl<double>{}}, {2, 4});
+  check_compute_all(prod, n);
+  check_compute_all(SecondOrderConeTpl<double>{}, n);
+  check_compute_all(PositiveSemidefiniteConeTpl<double>(3), 9);
+}
+
+/// Check a (possibly dense) projection Jacobian against finite differences of
+/// the projection, and the Moreau decomposition of the input.
+template <typename Set>
+void check_cone_projection(const Set &set, const ConstVectorRef &z) {
+  const long n = z.size();
+  const double eps = 1e-7;
+  VectorXs zp(n), zn(n), zp2(n);
+  set.projection(z, zp);
+  set.normalConeProjection(z, zn);
+  BOOST_CHECK((zp + zn).isApprox(z));
+  BOOST_CHECK_SMALL(zp.dot(zn), 1e-10);
+  set.projection(zp, zp2);
+  BOOST_CHECK(zp2.isApprox(zp));
+
+  MatrixXs Jfd(n, n);
+  VectorXs zdz = z;
+  for (long i = 0; i < n; i++) {
+    zdz(i) += eps;
+    set.projection(zdz, zp2);
+    Jfd.col(i) = (zp2 - zp) / eps;
+    zdz(i) = z(i);
+  }
+  MatrixXs J = MatrixXs::Identity(n, n);
+  set.applyProjectionJacobian(z, J);
+  BOOST_CHECK((J - Jfd).lpNorm<Eigen::Infinity>() < 1e-5);
+  MatrixXs Jn = MatrixXs::Identity(n, n);
+  set.applyNormalConeProjectionJacobian(z, Jn);
+  BOOST_CHECK((J + Jn).isIdentity());
+}
+
+BOOST_AUTO_TEST_CASE(second_order_cone) {
+  SecondOrderConeTpl<double> soc;
+  const long n = 5;
+  VectorXs z = VectorXs::Random(n);
+  z(0) = 2 * z.tail(n - 1).norm();
+  check_cone_projection(soc, z); // interior
+  z(0) = -z(0);
+  check_cone_projection(soc, z); // polar cone
+  z(0) = 0.3 * z.tail(n - 1).norm();
+  check_cone_projection(soc, z);
+  z(0) = -z(0);
+  check_cone_projection(soc, z);
+
+  ConstraintSetTpl<double>::ActiveType active(n);
+  soc.computeActiveSet(z, active);
+  BOOST_CHECK(active.all());
+}
+
+BOOST_AUTO_TEST_CASE(psd_cone) {
+  const int n = 3;
+  PositiveSemidefiniteConeTpl<double> psd(n);
+  BOOST_CHECK_THROW(PositiveSemidefiniteConeTpl<double>(0), std::runtime_error);
+  MatrixXs A = MatrixXs::Random(n, n);
+  MatrixXs Z = A + A.transpose();
+  Z.diagonal().array() += 0.5;
+  Eigen::Map<const VectorXs> z(Z.data(), n * n);
+  check_cone_projection(psd, z);
+
+  VectorXs zp(n * n);
+  psd.projection(z, zp);
+  Eigen::Map<const MatrixXs> Zp(zp.data(), n, n);
+  Eigen::SelfAdjointEigenSolver<MatrixXs> es(Zp);
+  BOOST_CHECK(es.eigenvalues().minCoeff() > -1e-12);
+  BOOST_CHECK(Zp.isApprox(Zp.transpose()));
+
+  // compare against a reference eigendecomposition, on a larger input which
+  // is not symmetric
+  const int m = 6;
+  PositiveSemidefiniteConeTpl<double> psd6(m);
+  MatrixXs B = MatrixXs::Random(m, m);
+  Eigen::Map<const VectorXs> b(B.data(), m * m);
+  Eigen::SelfAdjointEigenSolver<MatrixXs> esb(0.5 * (B + B.transpose()));
+  const MatrixXs &V = esb.eigenvectors();
+  MatrixXs Bp = V * esb.eigenvalues().cwiseMax(0.).asDiagonal() * V.transpose();
+  VectorXs bp(m * m);
+  psd6.projection(b, bp);
+  BOOST_CHECK(Eigen::Map<const MatrixXs>(bp.data(), m, m).isApprox(Bp, 1e-10));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -1,5 +1,9 @@
 #include "proxsuite-nlp/modelling/costs/squared-distance.hpp"
+#include "proxsuite-nlp/modelling/spaces/cartesian-product.hpp"
+#include "proxsuite-nlp/modelling/spaces/tangent-bundle.hpp"
+#include "proxsuite-nlp/modelling/spaces/vector-space.hpp"
 #include "proxsuite-nlp/cost-sum.hpp"
+#include "proxsuite-nlp/proximal-penalty.hpp"
 
 #include "proxsuite-nlp/fmt-eigen.hpp"
 
@@ -81,4 +85,121 @@ BOOST_AUTO_TEST_CASE(test_cast_cost) {
 
 #endif
 
+/// Vector space with a scaled retraction \f$x\oplus v = x + sv\f$, whose
+/// Jacobians are reported as dense.
+struct ScaledVectorSpace : ManifoldAbstractTpl<Scalar> {
+  PROXSUITE_NLP_DYNAMIC_TYPEDEFS(Scalar);
+  int dim_;
+  Scalar scale_;
+  ScaledVectorSpace(int dim, Scalar scale) : dim_(dim), scale_(scale) {}
+  int nx() const { return dim_; }
+  int ndx() const { return dim_; }
+  void integrate_impl(const ConstVectorRef &x, const ConstVectorRef &v,
+                      VectorRef out) const {
+    out = x + scale_ * v;
+  }
+  void difference_impl(const ConstVectorRef &x0, const ConstVectorRef &x1,
+                       VectorRef out) const {
+    out = (x1 - x0) / scale_;
+  }
+  void Jintegrate_impl(const ConstVectorRef &, const ConstVectorRef &,
+                       MatrixRef Jout, int arg) const {
+    Jout.setIdentity();
+    if (arg == 1)
+      Jout *= scale_;
+  }
+  void JintegrateTransport(const ConstVectorRef &, const ConstVectorRef &,
+                           MatrixRef, int) const {}
+  void Jdifference_impl(const ConstVectorRef &, const ConstVectorRef &,
+                        MatrixRef Jout, int arg) const {
+    Jout.setIdentity();
+    Jout *= (arg == 0 ? -1. : 1.) / scale_;
+  }
+};
+
+/// Compare the structured derivatives of QuadraticDistanceCostTpl with those
+/// of the generic quadratic residual cost.
+void checkDistanceCost(const polymorphic<ManifoldAbstractTpl<Scalar>> &space,
+                       JacobianStructure structure) {
+  using MatrixXs = Eigen::MatrixXd;
+  using VectorXs = Eigen::VectorXd;
+  const int ndx = space->ndx();
+  BOOST_CHECK(space->jacobianStructure() == structure);
+  const MatrixXs A = MatrixXs::Random(ndx, ndx);
+  const MatrixXs W = A * A.transpose() + MatrixXs::Identity(ndx, ndx);
+  const VectorXs target = space->rand(), x = space->rand();
+
+  QuadraticDistanceCostTpl<Scalar> cost(space, target, W);
+  QuadraticResidualCostTpl<Scalar> ref(
+      std::make_shared<ManifoldDifferenceToPoint<Scalar>>(space, target), W);
+  cost.slope_.setRandom();
+  ref.slope_ = cost.slope_;
+  for (bool gauss_newton : {true, false}) {
+    cost.gauss_newton_ = ref.gauss_newton_ = gauss_newton;
+    VectorXs g(ndx), gref(ndx);
+    MatrixXs H(ndx, ndx), Href(ndx, ndx);
+    BOOST_CHECK_CLOSE(cost.call(x), ref.call(x), 1e-10);
+    cost.computeGradient(x, g);
+    ref.computeGradient(x, gref);
+    BOOST_CHECK(g.isApprox(gref));
+    cost.computeHessian(x, H);
+    ref.computeHessian(x, Href);
+    BOOST_CHECK(H.isApprox(Href));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(test_distance_cost_structure) {
+  using Manifold = ManifoldAbstractTpl<Scalar>;
+  using VectorSpace = VectorSpaceTpl<Scalar>;
+  polymorphic<Manifold> rn(VectorSpace(4));
+  polymorphic<Manifold> scaled(ScaledVectorSpace(3, 2.));
+  checkDistanceCost(rn, JacobianStructure::IDENTITY);
+  checkDistanceCost(scaled, JacobianStructure::DENSE);
+  checkDistanceCost(rn * rn, JacobianStructure::IDENTITY);
+  CartesianProductTpl<Scalar> prod = scaled * rn;
+  prod.addComponent(ScaledVectorSpace(2, 0.5));
+  checkDistanceCost(prod, JacobianStructure::BLOCK_DIAGONAL);
+  BOOST_CHECK(prod.jacobianBlocks() == std::vector<int>({3, 4, 2}));
+  polymorphic<Manifold> tvs{TangentBundleTpl<VectorSpace>(3)};
+  checkDistanceCost(tvs, JacobianStructure::IDENTITY);
+  polymorphic<Manifold> tscaled{TangentBundleTpl<ScaledVectorSpace>(2, 3.)};
+  checkDistanceCost(tscaled, JacobianStructure::BLOCK_DIAGONAL);
+  checkDistanceCost(prod * tscaled, JacobianStructure::BLOCK_DIAGONAL);
+}
+
+/// Compare the proximal penalty with the equivalent distance cost.
+void checkProximalPenalty(
+    const polymorphic<ManifoldAbstractTpl<Scalar>> &space) {
+  using MatrixXs = Eigen::MatrixXd;
+  using VectorXs = Eigen::VectorXd;
+  const int ndx = space->ndx();
+  const Scalar rho = 0.3;
+  const VectorXs target = space->rand(), x = space->rand();
+  ProximalPenaltyTpl<Scalar> penalty(space, space->neutral(), 1.);
+  penalty.updateTarget(target);
+  penalty.setWeight(rho);
+  QuadraticDistanceCostTpl<Scalar> ref(space, target,
+                                       rho * MatrixXs::Identity(ndx, ndx));
+
+  VectorXs g(ndx), gref(ndx);
+  MatrixXs H(ndx, ndx), Href(ndx, ndx);
+  BOOST_CHECK_CLOSE(penalty.call(x), ref.call(x), 1e-10);
+  penalty.computeGradient(x, g);
+  ref.computeGradient(x, gref);
+  BOOST_CHECK(g.isApprox(gref));
+  H.setIdentity();
+  penalty.addHessian(H);
+  ref.computeHessian(x, Href);
+  BOOST_CHECK(H.isApprox(Href + MatrixXs::Identity(ndx, ndx)));
+}
+
+BOOST_AUTO_TEST_CASE(test_proximal_penalty) {
+  using Manifold = ManifoldAbstractTpl<Scalar>;
+  polymorphic<Manifold> rn(VectorSpaceTpl<Scalar>(4));
+  polymorphic<Manifold> scaled(ScaledVectorSpace(3, 2.));
+  checkProximalPenalty(rn);
+  checkProximalPenalty(scaled);
+  checkProximalPenalty(scaled * rn);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -1,6 +1,24 @@
 #include "proxsuite-nlp/modelling/residuals/linear.hpp"
 #include "proxsuite-nlp/function-ops.hpp"
+#include "proxsuite-nlp/problem-base.hpp"
+#include "proxsuite-nlp/workspace.hpp"
+#include "proxsuite-nlp/modelling/constraints/equality-constraint.hpp"
+#include "proxsuite-nlp/modelling/costs/squared-distance.hpp"
+#include "proxsuite-nlp/modelling/residuals/state-residual.hpp"
+#include "proxsuite-nlp/modelling/spaces/vector-space.hpp"
 #include "proxsuite-nlp/fmt-eigen.hpp"
+#ifdef PROXSUITE_NLP_WITH_PINOCCHIO
+#include <pinocchio/config.hpp>
+#if PINOCCHIO_VERSION_AT_LEAST(3, 0, 0)
+#include <pinocchio/multibody/sample-models.hpp>
+#else
+#include <pinocchio/parsers/sample-models.hpp>
+#endif // PINOCCHIO_VERSION_AT_LEAST
+#include "proxsuite-nlp/modelling/residuals/multibody-residuals.hpp"
+#include "proxsuite-nlp/modelling/residuals/rigid-transform-point.hpp"
+#include "proxsuite-nlp/modelling/spaces/pinocchio-groups.hpp"
+#include "proxsuite-nlp/modelling/spaces/cartesian-product.hpp"
+#endif
 
 #include <boost/test/unit_test.hpp>
 #include <boost/utility/binary.hpp>
@@ -64,4 +82,220 @@ BOOST_AUTO_TEST_CASE(test_compose) {
   BOOST_CHECK(v1_manual.isApprox(v0));
 }
 
+BOOST_AUTO_TEST_CASE(test_jacobian_columns) {
+  const int nx = 8;
+  using ResType = LinearFunctionTpl<double>;
+  Eigen::MatrixXd A1(3, nx), A2(2, nx);
+  A1.setZero();
+  A1.middleCols(2, 3).setRandom();
+  A2.setRandom();
+  auto res1 = std::make_shared<ResType>(A1, Eigen::VectorXd::Random(3));
+  auto res2 = std::make_shared<ResType>(A2, Eigen::VectorXd::Random(2));
+  BOOST_CHECK(!res1->hasSparseJacobian());
+  BOOST_CHECK_THROW(res1->setJacobianColumns(6, 3), std::runtime_error);
+  res1->setJacobianColumns(2, 3);
+  BOOST_CHECK(res1->hasSparseJacobian());
+
+  // composition keeps the zero columns of the inner function
+  Eigen::MatrixXd B(2, 3);
+  B.setRandom();
+  auto outer = std::make_shared<ResType>(B, Eigen::VectorXd::Zero(2));
+  ComposeFunctionTpl<double> comp(outer, res1);
+  BOOST_CHECK_EQUAL(comp.jacobianColStart(), 2);
+  BOOST_CHECK_EQUAL(comp.jacobianColSize(), 3);
+
+  using Problem = ProblemTpl<double>;
+  VectorSpaceTpl<double> space(nx);
+  auto cost = std::make_shared<QuadraticDistanceCostTpl<double>>(space);
+  std::vector<Problem::ConstraintObject> cstrs;
+  cstrs.emplace_back(res1, EqualityConstraintTpl<double>{});
+  cstrs.emplace_back(res2, EqualityConstraintTpl<double>{});
+  Problem problem(space, cost, cstrs);
+  BOOST_CHECK(problem.hasSparseJacobians());
+
+  WorkspaceTpl<double> ws(problem);
+  Eigen::VectorXd x0 = space.rand();
+  problem.computeDerivatives(x0, ws);
+  Eigen::VectorXd lams = Eigen::VectorXd::Random(5);
+  Eigen::VectorXd out = Eigen::VectorXd::Zero(nx);
+  problem.addJacobianTransposeProduct(ws.data_jacobians, lams, out);
+  Eigen::VectorXd out_ref = ws.data_jacobians.transpose() * lams;
+  BOOST_CHECK(out.isApprox(out_ref));
+}
+
+struct CountingCache : EvaluationCacheBase {
+  int num_invalidations = 0;
+  void invalidate() override { num_invalidations++; }
+};
+
+BOOST_AUTO_TEST_CASE(test_evaluation_cache) {
+  const int nx = 4;
+  using Problem = ProblemTpl<double>;
+  VectorSpaceTpl<double> space(nx);
+  auto cost = std::make_shared<QuadraticDistanceCostTpl<double>>(space);
+  auto res = std::make_shared<LinearFunctionTpl<double>>(
+      Eigen::MatrixXd::Random(2, nx), Eigen::VectorXd::Random(2));
+  std::vector<Problem::ConstraintObject> cstrs;
+  cstrs.emplace_back(res, EqualityConstraintTpl<double>{});
+  Problem problem(space, cost, cstrs);
+  BOOST_CHECK(!problem.hasCaches());
+
+  auto cache = std::make_shared<CountingCache>();
+  problem.addCache(cache);
+  BOOST_CHECK(problem.hasCaches());
+
+  WorkspaceTpl<double> ws(problem);
+  Eigen::VectorXd x0 = space.rand();
+  problem.evaluate(x0, ws);
+  BOOST_CHECK_EQUAL(cache->num_invalidations, 1);
+  // derivatives are computed at the point of the last evaluation
+  problem.computeDerivatives(x0, ws);
+  BOOST_CHECK_EQUAL(cache->num_invalidations, 1);
+  problem.evaluateWithDerivatives(x0, ws);
+  BOOST_CHECK_EQUAL(cache->num_invalidations, 2);
+}
+
+BOOST_AUTO_TEST_CASE(test_manifold_difference_vhp) {
+  // the residual is affine on vector spaces
+  VectorSpaceTpl<double> space(4);
+  ManifoldDifferenceToPoint<double> res(space, space.rand());
+  Eigen::MatrixXd H = Eigen::MatrixXd::Random(4, 4);
+  res.vectorHessianProduct(space.rand(), Eigen::VectorXd::Random(4), H);
+  BOOST_CHECK(H.isZero());
+}
+
+#ifdef PROXSUITE_NLP_WITH_PINOCCHIO
+
+/// Compare the Jacobian of @p fun to forward finite differences on @p space.
+void checkMultibodyJacobian(const ManifoldAbstractTpl<double> &space,
+                            const C2FunctionTpl<double> &fun) {
+  const double fd_eps = 1e-7;
+  const int ndx = space.ndx();
+  Eigen::VectorXd x = space.integrate(space.neutral(),
+                                      Eigen::VectorXd::Random(ndx));
+  Eigen::MatrixXd J(fun.nr(), ndx), J_fd(fun.nr(), ndx);
+  J.setRandom();
+  fun.computeJacobian(x, J);
+  const Eigen::VectorXd r0 = fun(x);
+  Eigen::VectorXd dx = Eigen::VectorXd::Zero(ndx);
+  for (int i = 0; i < ndx; i++) {
+    dx[i] = fd_eps;
+    J_fd.col(i) = (fun(space.integrate(x, dx)) - r0) / fd_eps;
+    dx[i] = 0.;
+  }
+  BOOST_CHECK_SMALL((J - J_fd).lpNorm<Eigen::Infinity>(), 1e-5);
+}
+
+BOOST_AUTO_TEST_CASE(test_multibody_residuals) {
+  using SE3 = pinocchio::SE3Tpl<double>;
+  using DataCache = MultibodyDataCacheTpl<double>;
+  pinocchio::ModelTpl<double> model;
+  pinocchio::buildModels::manipulator(model);
+  MultibodyConfiguration<double> space(model);
+  MultibodyPhaseSpace<double> phase_space(model);
+  const pinocchio::FrameIndex fid = model.frames.size() - 1;
+  const Eigen::Vector3d target = Eigen::Vector3d::Random();
+
+  FramePlacementResidualTpl<double> placement(space, fid, SE3::Random());
+  FrameTranslationResidualTpl<double> translation(space, fid, target);
+  CenterOfMassResidualTpl<double> com(space, target);
+  checkMultibodyJacobian(space, placement);
+  checkMultibodyJacobian(space, translation);
+  checkMultibodyJacobian(space, com);
+  // each residual owns a cache, which concurrent evaluations would share
+  placement.setThreadSafe(true);
+  BOOST_CHECK(!placement.isThreadSafe());
+  BOOST_CHECK_THROW(
+      FrameTranslationResidualTpl<double>(space, model.frames.size(), target),
+      std::runtime_error);
+
+  // on the phase space, the Jacobian is zero w.r.t. the velocity
+  FrameTranslationResidualTpl<double> translation2(phase_space, fid, target);
+  BOOST_CHECK(translation2.hasSparseJacobian());
+  BOOST_CHECK_EQUAL(translation2.jacobianColSize(), model.nv);
+  checkMultibodyJacobian(phase_space, translation2);
+
+  // residuals sharing a cache run the kinematics once per point
+  auto cache = std::make_shared<DataCache>(model);
+  FramePlacementResidualTpl<double> r1(phase_space, fid, SE3::Random(), cache);
+  CenterOfMassResidualTpl<double> r2(phase_space, target, cache);
+  Eigen::VectorXd x0 = phase_space.neutral();
+  Eigen::MatrixXd J1(6, phase_space.ndx()), J2(3, phase_space.ndx());
+  r1(x0);
+  r2(x0);
+  r1.computeJacobian(x0, J1);
+  r2.computeJacobian(x0, J2);
+  BOOST_CHECK_EQUAL(cache->numKinematicsPasses(), 1);
+  BOOST_CHECK_EQUAL(cache->numJacobiansPasses(), 1);
+  cache->invalidate();
+  r1(x0);
+  BOOST_CHECK_EQUAL(cache->numKinematicsPasses(), 2);
+}
+
+/// Hessian of \f$\delta\mapsto v^\top f(x\oplus\delta)\f$ at zero, from
+/// second-order central differences.
+Eigen::MatrixXd secondOrderDifferences(const ManifoldAbstractTpl<double> &space,
+                                       const C2FunctionTpl<double> &fun,
+                                       const Eigen::VectorXd &x,
+                                       const Eigen::VectorXd &v) {
+  const double h = 1e-4;
+  const int ndx = space.ndx();
+  auto g = [&](const Eigen::VectorXd &dx) {
+    return v.dot(fun(space.integrate(x, dx)));
+  };
+  Eigen::MatrixXd H(ndx, ndx);
+  Eigen::VectorXd ei = Eigen::VectorXd::Zero(ndx), ej = ei;
+  for (int i = 0; i < ndx; i++) {
+    ei[i] = h;
+    for (int j = 0; j < ndx; j++) {
+      ej[j] = h;
+      H(i, j) = (g(ei + ej) - g(ei - ej) - g(ej - ei) + g(-ei - ej)) /
+                (4 * h * h);
+      ej[j] = 0.;
+    }
+    ei[i] = 0.;
+  }
+  return H;
+}
+
+void checkVectorHessianProduct(const ManifoldAbstractTpl<double> &space,
+                               const C2FunctionTpl<double> &fun) {
+  const Eigen::VectorXd x = space.rand();
+  const Eigen::VectorXd v = Eigen::VectorXd::Random(fun.nr());
+  Eigen::MatrixXd H = Eigen::MatrixXd::Random(fun.ndx(), fun.ndx());
+  fun.vectorHessianProduct(x, v, H);
+  const Eigen::MatrixXd H_ref = secondOrderDifferences(space, fun, x, v);
+  BOOST_CHECK_SMALL((H - H_ref).lpNorm<Eigen::Infinity>(), 1e-5);
+}
+
+BOOST_AUTO_TEST_CASE(test_lie_group_vhp) {
+  using Manifold = ManifoldAbstractTpl<double>;
+  using SO3 =
+      PinocchioLieGroup<pinocchio::SpecialOrthogonalOperationTpl<3, double>>;
+  using SE3 =
+      PinocchioLieGroup<pinocchio::SpecialEuclideanOperationTpl<3, double>>;
+
+  RigidTransformationPointActionTpl<double> action(Eigen::Vector3d::Random());
+  checkVectorHessianProduct(action.space_, action);
+
+  // dense Jacobian: the finite differences are left to
+  // finite_difference_wrapper
+  polymorphic<Manifold> se3{SE3()};
+  ManifoldDifferenceToPoint<double> diff1(se3, se3->rand());
+  Eigen::MatrixXd H = Eigen::MatrixXd::Random(6, 6);
+  diff1.vectorHessianProduct(se3->rand(), Eigen::VectorXd::Random(6), H);
+  BOOST_CHECK(H.isZero());
+
+  // block-diagonal Jacobian
+  polymorphic<Manifold> so3{SO3()};
+  polymorphic<Manifold> vs{VectorSpaceTpl<double>(2)};
+  CartesianProductTpl<double> prod = so3 * vs;
+  prod.addComponent(se3);
+  polymorphic<Manifold> prod_ptr{prod};
+  ManifoldDifferenceToPoint<double> diff2(prod_ptr, prod.rand());
+  checkVectorHessianProduct(prod, diff2);
+}
+
+#endif
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -3,6 +3,7 @@
 #include <boost/math/tools/polynomial.hpp>
 
 #include "proxsuite-nlp/linesearch-armijo.hpp"
+#include "proxsuite-nlp/linesearch-wolfe.hpp"
 
 using namespace proxsuite::nlp;
 using boost::math::tools::polynomial;
@@ -28,3 +29,138 @@ BOOST_AUTO_TEST_CASE(armijo) {
       dp.data()[2], dp.data()[1], dp.data()[0]);
   fmt::print("Derivative roots: {:.4e} / {:.4e}\n", r0, r1);
 }
+
+BOOST_AUTO_TEST_CASE(armijo_batched) {
+  // phi(a) = (a - 0.1)^2: only small steps decrease enough
+  auto phi = [](double a) { return (a - 0.1) * (a - 0.1); };
+  const double phi0 = phi(0.), dphi0 = -0.2;
+
+  Linesearch<double>::Options opts;
+  opts.parallel_trials = 3;
+  ArmijoLinesearch<double> ls{opts};
+  std::size_t num_calls = 0;
+  auto phis = [&](const std::vector<double> &alphas,
+                  std::vector<double> &values) {
+    BOOST_CHECK_EQUAL(alphas.size(), opts.parallel_trials);
+    num_calls++;
+    for (std::size_t j = 0; j < alphas.size(); j++)
+      values[j] = alphas[j] > 0.9 ? std::nan("") : phi(alphas[j]);
+  };
+  double alpha = 0.;
+  double phi_new = ls.runBatched(phis, phi0, dphi0, alpha);
+  // ladder 1, 0.5, 0.25 then 0.125: the first satisfying the Armijo condition
+  BOOST_CHECK_EQUAL(num_calls, 2);
+  BOOST_CHECK_EQUAL(alpha, 0.125);
+  BOOST_CHECK_EQUAL(phi_new, phi(0.125));
+}
+
+BOOST_AUTO_TEST_CASE(wolfe) {
+  polynomial<double> p1{{1, 1}};
+  polynomial<double> p2{{-0.3, 1}};
+  polynomial<double> p = p1 * p2 * p2;
+  polynomial<double> dp = p.prime();
+
+  Linesearch<double>::Options opts;
+  for (auto interp : {LSInterpolation::BISECTION, LSInterpolation::CUBIC}) {
+    opts.interp_type = interp;
+    WolfeLinesearch<double> ls{opts};
+    double alpha_last = -1.;
+    auto phi = [&](double a, double &da) {
+      alpha_last = a;
+      da = dp(a);
+      return p(a);
+    };
+    double alpha = 0.;
+    const double phi0 = p(0.), dphi0 = dp(0.);
+    double phi_new = ls.run(phi, phi0, dphi0, alpha);
+    fmt::print("Found alpha = {:.4e} in {:d} evaluations\n", alpha,
+               ls.numEvals());
+
+    // strong Wolfe conditions
+    BOOST_CHECK_LE(phi_new, phi0 + opts.armijo_c1 * alpha * dphi0);
+    BOOST_CHECK_LE(std::abs(dp(alpha)), opts.wolfe_c2 * std::abs(dphi0));
+    // the accepted step is the last one evaluated
+    BOOST_CHECK_EQUAL(alpha, alpha_last);
+    BOOST_CHECK_EQUAL(phi_new, p(alpha));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(wolfe_fallback) {
+  // phi(a) = 1 + a with a wrong slope dphi(0) = -1: no step size gives a
+  // sufficient decrease, and the linesearch falls back to alpha_min
+  Linesearch<double>::Options opts;
+  WolfeLinesearch<double> ls{opts};
+  double alpha_last = -1.;
+  auto phi = [&](double a, double &da) {
+    alpha_last = a;
+    da = 1.;
+    return 1. + a;
+  };
+  double alpha = 0.;
+  const double phi_new = ls.run(phi, 1., -1., alpha);
+  BOOST_CHECK_EQUAL(alpha, opts.alpha_min);
+  // the value and the last evaluation match the returned step size
+  BOOST_CHECK_EQUAL(alpha_last, alpha);
+  BOOST_CHECK_EQUAL(phi_new, 1. + opts.alpha_min);
+}
+
+BOOST_AUTO_TEST_CASE(nonmonotone) {
+  Linesearch<double>::Options opts;
+  opts.nonmonotone_window = 3;
+  NonmonotoneReference<double> ref;
+  // the reference value is the current value until the history is filled
+  BOOST_CHECK_EQUAL(ref.value(opts, 1.), 1.);
+
+  opts.nonmonotone = LSNonmonotone::MAX;
+  for (double v : {4., 3., 2., 1.})
+    ref.push(opts, v);
+  // the first value dropped out of the window
+  BOOST_CHECK_EQUAL(ref.value(opts, 1.), 3.);
+
+  // eta = 0: last value, eta = 1: mean of all the values
+  opts.nonmonotone = LSNonmonotone::AVERAGE;
+  for (double eta : {0., 1.}) {
+    opts.nonmonotone_eta = eta;
+    ref.reset();
+    for (double v : {4., 3., 2., 1.})
+      ref.push(opts, v);
+    BOOST_CHECK_CLOSE(ref.value(opts, 1.), eta == 0. ? 1. : 2.5, 1e-12);
+  }
+
+  // phi(a) = (a - 0.1)^2: the full step increases the merit value, but is
+  // accepted w.r.t. a larger reference value
+  auto phi = [](double a) { return (a - 0.1) * (a - 0.1); };
+  const double phi0 = phi(0.), dphi0 = -0.2;
+  ArmijoLinesearch<double> ls{opts};
+  double alpha = 0.;
+  ls.run(phi, phi0, dphi0, alpha);
+  BOOST_CHECK_LT(alpha, 1.);
+  ls.run(phi, phi0, dphi0, alpha, phi0 + 1.);
+  BOOST_CHECK_EQUAL(alpha, 1.);
+}
+
+BOOST_AUTO_TEST_CASE(failed_evaluations) {
+  // phi(a) = (a - 1)^2, undefined beyond a = 0.3
+  auto phi = [](double a) {
+    return a > 0.3 ? std::nan("") : (a - 1.) * (a - 1.);
+  };
+  auto dphi = [](double a) { return 2. * (a - 1.); };
+  const double phi0 = phi(0.), dphi0 = dphi(0.);
+
+  Linesearch<double>::Options opts;
+  double alpha = 0.;
+  ArmijoLinesearch<double> armijo{opts};
+  double phi_new = armijo.run(phi, phi0, dphi0, alpha);
+  BOOST_CHECK_EQUAL(alpha, 0.25);
+  BOOST_CHECK_EQUAL(phi_new, phi(0.25));
+
+  WolfeLinesearch<double> wolfe{opts};
+  auto phi_dphi = [&](double a, double &da) {
+    da = dphi(a);
+    return phi(a);
+  };
+  phi_new = wolfe.run(phi_dphi, phi0, dphi0, alpha);
+  BOOST_CHECK_LE(alpha, 0.3);
+  BOOST_CHECK(std::isfinite(phi_new));
+  BOOST_CHECK_LE(phi_new, phi0 + opts.armijo_c1 * alpha * dphi0);
+}
@@ -18,6 +18,8 @@
 
 #include <boost/test/unit_test.hpp>
 
+#include <limits>
+
 BOOST_AUTO_TEST_SUITE(manifold)
 
 using namespace proxsuite::nlp;
@@ -60,6 +62,144 @@ BOOST_AUTO_TEST_CASE(test_vectorspace) {
   x1 = prod2.rand();
 }
 
+/// Check the batched operations against the pointwise ones.
+void checkBatchOperations(const Manifold &space, const long N) {
+  const int nx = space.nx(), ndx = space.ndx();
+  Eigen::MatrixXd X0(nx, N), X1(nx, N), V(ndx, N);
+  for (long k = 0; k < N; k++) {
+    X0.col(k) = space.rand();
+    X1.col(k) = space.rand();
+    V.col(k).setRandom();
+  }
+  Eigen::MatrixXd Xout(nx, N), Vout(ndx, N);
+  Eigen::MatrixXd Jout(ndx, N * ndx), J(ndx, ndx);
+  space.integrate_batch(X0, V, Xout);
+  space.difference_batch(X0, X1, Vout);
+  for (long k = 0; k < N; k++) {
+    BOOST_CHECK(Xout.col(k).isApprox(space.integrate(X0.col(k), V.col(k))));
+    BOOST_CHECK(Vout.col(k).isApprox(space.difference(X0.col(k), X1.col(k))));
+  }
+  for (int arg : {0, 1}) {
+    space.Jintegrate_batch(X0, V, Jout, arg);
+    for (long k = 0; k < N; k++) {
+      space.Jintegrate(X0.col(k), V.col(k), J, arg);
+      BOOST_CHECK(Jout.middleCols(k * ndx, ndx).isApprox(J));
+    }
+    space.Jdifference_batch(X0, X1, Jout, arg);
+    for (long k = 0; k < N; k++) {
+      space.Jdifference(X0.col(k), X1.col(k), J, arg);
+      BOOST_CHECK(Jout.middleCols(k * ndx, ndx).isApprox(J));
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(batch_operations) {
+  polymorphic<Manifold> space1(VectorSpace(3));
+  polymorphic<Manifold> space2(VectorSpace(5));
+  checkBatchOperations(*space1, 7);
+  checkBatchOperations(space1 * space2, 7);
+#ifdef PROXSUITE_NLP_WITH_PINOCCHIO
+  using SO3 =
+      PinocchioLieGroup<pinocchio::SpecialOrthogonalOperationTpl<3, double>>;
+  polymorphic<Manifold> so3{SO3()};
+  checkBatchOperations(*so3, 7);
+  checkBatchOperations(so3 * space1, 7);
+#endif
+}
+
+/// Check the cached offsets, component views and block-diagonal Jacobians of
+/// a Cartesian product against its components.
+void checkCartesianProduct(const CartesianProductTpl<double> &prod) {
+  const int ndx = prod.ndx();
+  int nx_sum = 0, ndx_sum = 0;
+  for (std::size_t i = 0; i < prod.numComponents(); i++) {
+    BOOST_CHECK_EQUAL(prod.nxOffset(i), nx_sum);
+    BOOST_CHECK_EQUAL(prod.ndxOffset(i), ndx_sum);
+    nx_sum += prod.getComponent(i).nx();
+    ndx_sum += prod.getComponent(i).ndx();
+  }
+  BOOST_CHECK_EQUAL(prod.nx(), nx_sum);
+  BOOST_CHECK_EQUAL(ndx, ndx_sum);
+
+  const Eigen::VectorXd x0 = prod.rand(), x1 = prod.rand();
+  const Eigen::VectorXd v = Eigen::VectorXd::Random(ndx);
+  BOOST_CHECK(prod.isNormalized(x0));
+  const auto xs = prod.split(Eigen::Ref<const Eigen::VectorXd>(x0));
+  for (std::size_t i = 0; i < prod.numComponents(); i++) {
+    BOOST_CHECK(prod.getComponentPoint(x0, i).isApprox(xs[i]));
+  }
+
+  const double nan = std::numeric_limits<double>::quiet_NaN();
+  Eigen::MatrixXd J(ndx, ndx), Jref(ndx, ndx);
+  Eigen::MatrixXd Jblocks(ndx, prod.maxComponentNdx());
+  for (int arg : {0, 1}) {
+    J.setConstant(nan);
+    Jref.setZero();
+    prod.Jintegrate(x0, v, J, arg);
+    prod.Jintegrate_blocks(x0, v, Jblocks, arg);
+    for (std::size_t i = 0; i < prod.numComponents(); i++) {
+      const int c = prod.ndxOffset(i), n = prod.getComponent(i).ndx();
+      prod.getComponent(i).Jintegrate(prod.getComponentPoint(x0, i),
+                                      prod.getComponentTangent(v, i),
+                                      Jref.block(c, c, n, n), arg);
+      BOOST_CHECK(Jblocks.block(c, 0, n, n).isApprox(Jref.block(c, c, n, n)));
+    }
+    BOOST_CHECK(J.isApprox(Jref));
+
+    J.setConstant(nan);
+    Jref.setZero();
+    prod.Jdifference(x0, x1, J, arg);
+    prod.Jdifference_blocks(x0, x1, Jblocks, arg);
+    for (std::size_t i = 0; i < prod.numComponents(); i++) {
+      const int c = prod.ndxOffset(i), n = prod.getComponent(i).ndx();
+      prod.getComponent(i).Jdifference(prod.getComponentPoint(x0, i),
+                                       prod.getComponentPoint(x1, i),
+                                       Jref.block(c, c, n, n), arg);
+      BOOST_CHECK(Jblocks.block(c, 0, n, n).isApprox(Jref.block(c, c, n, n)));
+    }
+    BOOST_CHECK(J.isApprox(Jref));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(cartesian_product_structure) {
+  polymorphic<Manifold> space1(VectorSpace(3));
+  polymorphic<Manifold> space2(VectorSpace(5));
+  CartesianProductTpl<double> prod = space1 * space2;
+  checkCartesianProduct(prod);
+  prod.addComponent(space2 * space1);
+  BOOST_CHECK_EQUAL(prod.numComponents(), 4u);
+  checkCartesianProduct(prod);
+  // the offsets are also computed by the other constructors, and copied
+  CartesianProductTpl<double> prod2({space2, space1, space1});
+  checkCartesianProduct(prod2);
+  CartesianProductTpl<double> prod3(prod2);
+  checkCartesianProduct(prod3);
+  // empty and moved-from products have valid offsets
+  CartesianProductTpl<double> empty;
+  BOOST_CHECK_EQUAL(empty.nx(), 0);
+  CartesianProductTpl<double> moved(std::move(prod3));
+  checkCartesianProduct(moved);
+  BOOST_CHECK_EQUAL(prod3.numComponents(), 0u);
+  BOOST_CHECK_EQUAL(prod3.nx(), 0);
+  BOOST_CHECK_EQUAL(prod3.ndx(), 0);
+  prod3.addComponent(space1);
+  BOOST_CHECK_EQUAL(prod3.nx(), 3);
+  prod3 = std::move(moved);
+  checkCartesianProduct(prod3);
+  BOOST_CHECK_EQUAL(moved.ndx(), 0);
+#ifdef PROXSUITE_NLP_WITH_PINOCCHIO
+  using SO3 =
+      PinocchioLieGroup<pinocchio::SpecialOrthogonalOperationTpl<3, double>>;
+  polymorphic<Manifold> so3{SO3()};
+  CartesianProductTpl<double> prod4 = space1 * so3;
+  prod4.addComponent(so3);
+  checkCartesianProduct(prod4);
+  Eigen::VectorXd x = prod4.neutral();
+  prod4.getComponentPointWrite(x, 1).setZero();
+  BOOST_CHECK(!prod4.isNormalized(x));
+#endif
+}
+
 #ifdef PROXSUITE_NLP_WITH_PINOCCHIO
 
 BOOST_AUTO_TEST_CASE(test_lg_vecspace) {
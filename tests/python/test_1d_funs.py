@@ -8,7 +8,10 @@ import itertools
 space = manifolds.R()
 nx = space.nx
 
-linesearch_strategies = [proxsuite_nlp.LinesearchStrategy.ARMIJO]
+linesearch_strategies = [
+    proxsuite_nlp.LinesearchStrategy.ARMIJO,
+    proxsuite_nlp.LinesearchStrategy.WOLFE,
+]
 
 linesearch_interp_type = [
     proxsuite_nlp.LSInterpolation.BISECTION,
@@ -1,3 +1,5 @@
+import collections
+
 import numpy as np
 import pytest
 import proxsuite_nlp
@@ -66,6 +68,57 @@ class TestCompose:
         assert "Incompatible dimensions" in exc_info.value.args[0]
 
 
+class SphereAll(proxsuite_nlp.C2Function):
+    """Constraint 0.5 * |x|^2 - 1 = 0, implementing the combined protocol."""
+
+    def __init__(self, nx):
+        super().__init__(nx, nx, 1)
+        self.reset_calls()
+
+    def reset_calls(self):
+        # number of calls, keyed by the requested outputs (value, Jacobian)
+        self.num_calls = collections.Counter()
+
+    def evaluate_all(self, x, out_value, out_jac, lam, out_vhp):
+        self.num_calls[out_value is not None, out_jac is not None] += 1
+        if out_value is not None:
+            out_value[:] = 0.5 * x.dot(x) - 1.0
+        if out_jac is not None:
+            out_jac[:] = x
+        if out_vhp is not None:
+            out_vhp[:, :] = lam[0] * np.eye(x.size)
+
+
+def test_evaluate_all():
+    nx = 3
+    fn = SphereAll(nx)
+    x = np.random.randn(nx)
+    assert np.allclose(fn(x), 0.5 * x.dot(x) - 1.0)
+    assert np.allclose(fn.getJacobian(x), x[None])
+    assert fn.num_calls == {(True, False): 1, (False, True): 1}
+    assert np.allclose(fn.getVHP(x, np.array([2.0])), 2.0 * np.eye(nx))
+
+    space = manifolds.VectorSpace(nx)
+    target = 2.0 * np.ones(nx)
+    cost = proxsuite_nlp.costs.QuadraticDistanceCost(space, target, np.eye(nx))
+    cstr = proxsuite_nlp.constraints.createEqualityConstraint(fn)
+    problem = proxsuite_nlp.Problem(space, cost, [cstr])
+    solver = proxsuite_nlp.ProxNLPSolver(problem, 1e-8)
+    solver.setup()
+    fn.reset_calls()
+    flag = solver.solve(np.ones(nx))
+    assert flag == proxsuite_nlp.ConvergenceFlag.success
+    results = solver.results
+    x_ref = target * np.sqrt(2.0) / np.linalg.norm(target)
+    assert np.allclose(results.xopt, x_ref, atol=1e-6)
+    # the value and Jacobian at each iterate are computed in a single call:
+    # once per step, and once more at the last iterate of each outer loop
+    assert fn.num_calls[True, True] == results.num_iters + results.al_iters + 1
+    assert fn.num_calls[False, True] == 0
+    # the Armijo linesearch evaluates at least one trial value per step
+    assert fn.num_calls[True, False] >= results.num_iters
+
+
 if __name__ == "__main__":
     import sys
 
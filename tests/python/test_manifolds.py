@@ -5,7 +5,15 @@ Copyright (C) 2022 LAAS-CNRS, INRIA
 import pytest
 import numpy as np
 
-from proxsuite_nlp.manifolds import SO2, SO3, SE2, SE3, CartesianProduct
+from proxsuite_nlp.manifolds import (
+    SO2,
+    SO3,
+    SE2,
+    SE3,
+    CartesianProduct,
+    JacobianStructure,
+    VectorSpace,
+)
 from proxsuite_nlp import autodiff, residuals
 
 
@@ -71,6 +79,16 @@ def test_cartesian_product():
     print(d0)
     assert d0.size == prod.ndx
 
+    assert prod.jacobian_structure == JacobianStructure.BLOCK_DIAGONAL
+    assert prod.jacobian_blocks == [space1.ndx, space2.ndx]
+    for arg in (0, 1):
+        J = prod.Jdifference(x0, x1, arg)
+        Jb = prod.Jdifference_blocks(x0, x1, arg)
+        assert Jb.shape == (prod.ndx, prod.max_component_ndx)
+        for i in range(prod.num_components):
+            c, n = prod.ndxOffset(i), prod.getComponent(i).ndx
+            assert np.allclose(Jb[c : c + n, :n], J[c : c + n, c : c + n])
+
     # prod2
     prod2 = space1 * space1 * space2
     print("prod2:")
@@ -130,6 +148,28 @@ def test_cartesian_product():
     product_space_diff_test(s33)
 
 
+@pytest.mark.parametrize(
+    "space", [SE3(), VectorSpace(4), CartesianProduct(SO3(), VectorSpace(2))]
+)
+def test_batch_operations(space):
+    N = 5
+    X0 = np.stack([space.rand() for _ in range(N)], axis=1)
+    X1 = np.stack([space.rand() for _ in range(N)], axis=1)
+    V = np.random.randn(space.ndx, N)
+    Xout = space.integrate_batch(X0, V)
+    Vout = space.difference_batch(X0, X1)
+    J0 = space.Jdifference_batch(X0, X1, 0)
+    Ji = space.Jintegrate_batch(X0, V, 1)
+    ndx = space.ndx
+    for k in range(N):
+        assert np.allclose(Xout[:, k], space.integrate(X0[:, k], V[:, k]))
+        assert np.allclose(Vout[:, k], space.difference(X0[:, k], X1[:, k]))
+        J = space.Jdifference(X0[:, k], X1[:, k], 0)
+        assert np.allclose(J0[:, k * ndx : (k + 1) * ndx], J)
+        J = space.Jintegrate(X0[:, k], V[:, k], 1)
+        assert np.allclose(Ji[:, k * ndx : (k + 1) * ndx], J)
+
+
 if __name__ == "__main__":
     import sys
 
@@ -0,0 +1,115 @@
+"""
+Run several solvers concurrently from Python threads: the GIL is released by
+ProxNLPSolver.solve().
+"""
+
+import threading
+import time
+from concurrent.futures import ThreadPoolExecutor
+
+import numpy as np
+import pytest
+import proxsuite_nlp
+from proxsuite_nlp import manifolds, costs, residuals, constraints
+
+
+NUM_SOLVES = 8
+NUM_THREADS = 4
+
+
+def make_problem(nx, seed):
+    rng = np.random.default_rng(seed)
+    space = manifolds.VectorSpace(nx)
+    target = rng.standard_normal(nx)
+    cost = costs.QuadraticDistanceCost(space, target, np.eye(nx))
+    A = rng.standard_normal((nx // 2, nx))
+    b = rng.standard_normal(nx // 2)
+    cstr = constraints.createInequalityConstraint(residuals.LinearFunction(A, b))
+    return proxsuite_nlp.Problem(space, cost, [cstr])
+
+
+class PyQuadratic(proxsuite_nlp.C2Function):
+    """Python-defined function, whose trampolines re-acquire the GIL."""
+
+    def __init__(self, nx):
+        super().__init__(nx, nx, 1)
+
+    def __call__(self, x):
+        return np.array([0.5 * x.dot(x) - 1.0])
+
+    def computeJacobian(self, x, J):
+        J[:] = x
+
+    def vectorHessianProduct(self, x, v, H):
+        H[:, :] = v[0] * np.eye(x.size)
+
+
+def solve(problem):
+    solver = proxsuite_nlp.ProxNLPSolver(problem, 1e-8)
+    solver.setup()
+    x0 = np.ones(problem.manifold.nx)
+    flag = solver.solve(x0)
+    assert flag == proxsuite_nlp.ConvergenceFlag.success
+    return solver.results.xopt.copy()
+
+
+def test_concurrent_solves():
+    problems = [make_problem(200, seed) for seed in range(NUM_SOLVES)]
+    expected = [solve(p) for p in problems]
+
+    with ThreadPoolExecutor(NUM_THREADS) as pool:
+        results = list(pool.map(solve, problems))
+
+    for x, x_ref in zip(results, expected):
+        assert np.allclose(x, x_ref)
+
+
+def test_progress_during_solve():
+    # the main thread keeps running Python code while solves run on another
+    # thread: it never waits for the GIL as long as a solve lasts
+    problem = make_problem(400, 0)
+    durations = []
+    done = threading.Event()
+
+    def worker():
+        for _ in range(3):
+            t0 = time.perf_counter()
+            solve(problem)
+            durations.append(time.perf_counter() - t0)
+        done.set()
+
+    thread = threading.Thread(target=worker)
+    thread.start()
+    max_gap = 0.0
+    last = time.perf_counter()
+    while not done.is_set():
+        now = time.perf_counter()
+        max_gap = max(max_gap, now - last)
+        last = now
+    thread.join()
+    assert max_gap < 0.5 * min(durations)
+
+
+def test_concurrent_python_functions():
+    nx = 3
+    space = manifolds.VectorSpace(nx)
+    target = 2.0 * np.ones(nx)
+
+    def make():
+        # each problem owns its cost and constraint
+        cost = costs.QuadraticDistanceCost(space, target, np.eye(nx))
+        cstr = constraints.createEqualityConstraint(PyQuadratic(nx))
+        return proxsuite_nlp.Problem(space, cost, [cstr])
+
+    with ThreadPoolExecutor(NUM_THREADS) as pool:
+        results = list(pool.map(solve, [make() for _ in range(NUM_SOLVES)]))
+    # projection of the target onto the unit sphere
+    x_ref = target * np.sqrt(2.0) / np.linalg.norm(target)
+    for x in results:
+        assert np.allclose(x, x_ref, atol=1e-6)
+
+
+if __name__ == "__main__":
+    import sys
+
+    sys.exit(pytest.main(sys.argv))
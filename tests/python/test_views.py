@@ -0,0 +1,73 @@
+"""
+The workspace and results buffers are exposed as read-only views of the solver
+data.
+"""
+
+import numpy as np
+import pytest
+import proxsuite_nlp
+from proxsuite_nlp import manifolds, costs, residuals, constraints
+
+
+def data_ptr(a):
+    return a.__array_interface__["data"][0]
+
+
+def make_solver():
+    nx = 4
+    space = manifolds.VectorSpace(nx)
+    cost = costs.QuadraticDistanceCost(space, np.ones(nx), np.eye(nx))
+    A = np.eye(2, nx)
+    cstr = constraints.createEqualityConstraint(
+        residuals.LinearFunction(A, np.zeros(2))
+    )
+    problem = proxsuite_nlp.Problem(space, cost, [cstr])
+    solver = proxsuite_nlp.ProxNLPSolver(problem, 1e-8)
+    solver.setup()
+    return solver
+
+
+def test_workspace_views():
+    solver = make_solver()
+    ws = solver.workspace
+    kkt = ws.kkt_matrix
+    assert not kkt.flags.writeable
+    with pytest.raises(ValueError):
+        kkt[0, 0] = 1.0
+    # the same buffer is returned every time
+    assert data_ptr(kkt) == data_ptr(ws.kkt_matrix)
+    assert data_ptr(ws.data_jacobians) == data_ptr(ws.data_jacobians)
+
+    solver.solve(np.zeros(4))
+    # the views alias the solver data
+    assert np.array_equal(kkt, ws.kkt_matrix)
+    xopt = solver.results.xopt
+    assert not xopt.flags.writeable
+    assert np.allclose(xopt, [0.0, 0.0, 1.0, 1.0])
+
+
+class ViewCallback(proxsuite_nlp.BaseCallback):
+    def __init__(self):
+        super().__init__()
+        self.ptrs = set()
+        self.xs = []
+
+    def call(self, workspace, results):
+        self.ptrs.add(data_ptr(workspace.kkt_matrix))
+        self.xs.append(results.xopt.copy())
+
+
+def test_callback_views():
+    solver = make_solver()
+    cb = ViewCallback()
+    solver.register_callback(cb)
+    solver.solve(np.zeros(4))
+    # the callback receives the solver workspace, not a copy
+    assert cb.ptrs == {data_ptr(solver.workspace.kkt_matrix)}
+    assert np.allclose(cb.xs[-1], solver.results.xopt)
+
+
+if __name__ == "__main__":
+    import sys
+
+    sys.exit(pytest.main(sys.argv))
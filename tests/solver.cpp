@@ -1,5 +1,15 @@
 #include "proxsuite-nlp/prox-solver.hpp"
+#include "proxsuite-nlp/modelling/costs/squared-distance.hpp"
+#include "proxsuite-nlp/modelling/residuals/linear.hpp"
+#include "proxsuite-nlp/modelling/constraints/box-constraint.hpp"
+#include "proxsuite-nlp/modelling/constraints/equality-constraint.hpp"
+#include "proxsuite-nlp/modelling/constraints/negative-orthant.hpp"
+#include "proxsuite-nlp/modelling/constraints/second-order-cone.hpp"
+#include "proxsuite-nlp/modelling/constraints/positive-semidefinite-cone.hpp"
+#include "proxsuite-nlp/modelling/spaces/vector-space.hpp"
 
+#include <Eigen/LU>
+#include <limits>
 #include <boost/test/unit_test.hpp>
 
 BOOST_AUTO_TEST_SUITE(solver)
@@ -8,4 +18,442 @@ using namespace proxsuite::nlp;
 
 BOOST_AUTO_TEST_CASE(solve) {}
 
+BOOST_AUTO_TEST_CASE(sparse_jacobians) {
+  using Problem = ProblemTpl<double>;
+  using ResType = LinearFunctionTpl<double>;
+  const int nx = 10;
+  VectorSpaceTpl<double> space(nx);
+  Eigen::VectorXd target = Eigen::VectorXd::Random(nx);
+  auto cost = std::make_shared<QuadraticDistanceCostTpl<double>>(
+      space, target, Eigen::MatrixXd::Identity(nx, nx));
+
+  Eigen::MatrixXd A1 = Eigen::MatrixXd::Zero(2, nx);
+  Eigen::MatrixXd A2 = Eigen::MatrixXd::Zero(3, nx);
+  A1.middleCols(1, 4).setRandom();
+  A2.middleCols(6, 3).setRandom();
+  Eigen::VectorXd b1 = Eigen::VectorXd::Random(2);
+  Eigen::VectorXd b2 = Eigen::VectorXd::Random(3);
+
+  auto solve = [&](bool declare_sparse) {
+    auto res1 = std::make_shared<ResType>(A1, b1);
+    auto res2 = std::make_shared<ResType>(A2, b2);
+    if (declare_sparse) {
+      res1->setJacobianColumns(1, 4);
+      res2->setJacobianColumns(6, 3);
+    }
+    std::vector<Problem::ConstraintObject> cstrs;
+    cstrs.emplace_back(res1, EqualityConstraintTpl<double>{});
+    cstrs.emplace_back(res2, NegativeOrthantTpl<double>{});
+    Problem problem(space, cost, cstrs);
+    BOOST_CHECK_EQUAL(problem.hasSparseJacobians(), declare_sparse);
+
+    ProxNLPSolverTpl<double> solver(problem, 1e-8, 1e-2, 0.);
+    solver.setup();
+    Eigen::VectorXd x0 = space.neutral();
+    BOOST_CHECK_EQUAL(solver.solve(x0), ConvergenceFlag::SUCCESS);
+    return std::make_pair(solver.results_->x_opt,
+                          solver.results_->data_lams_opt);
+  };
+
+  auto dense = solve(false);
+  auto sparse = solve(true);
+  BOOST_CHECK(sparse.first.isApprox(dense.first, 1e-10));
+  BOOST_CHECK(sparse.second.isApprox(dense.second, 1e-10));
+}
+
+/// Rosenbrock function \f$ a(x_1 - x_0^2)^2 + (1 - x_0)^2 \f$, whose curved
+/// valley makes monotone linesearches take short steps.
+struct RosenbrockCost : CostFunctionBaseTpl<double> {
+  double a;
+
+  explicit RosenbrockCost(double a) : CostFunctionBaseTpl<double>(2, 2), a(a) {}
+
+  double call(const ConstVectorRef &x) const override {
+    return a * std::pow(x[1] - x[0] * x[0], 2) + std::pow(1. - x[0], 2);
+  }
+  void computeGradient(const ConstVectorRef &x, VectorRef out) const override {
+    const double r = x[1] - x[0] * x[0];
+    out[0] = -4. * a * r * x[0] - 2. * (1. - x[0]);
+    out[1] = 2. * a * r;
+  }
+  void computeHessian(const ConstVectorRef &x, MatrixRef out) const override {
+    const double r = x[1] - x[0] * x[0];
+    out(0, 0) = -4. * a * r + 8. * a * x[0] * x[0] + 2.;
+    out(0, 1) = out(1, 0) = -4. * a * x[0];
+    out(1, 1) = 2. * a;
+  }
+};
+
+BOOST_AUTO_TEST_CASE(nonmonotone_linesearch) {
+  using Problem = ProblemTpl<double>;
+  VectorSpaceTpl<double> space(2);
+  // inactive bound, for the solver to have a constraint
+  Eigen::MatrixXd A(1, 2);
+  A << 1., 0.;
+  std::vector<Problem::ConstraintObject> cstrs;
+  cstrs.emplace_back(std::make_shared<LinearFunctionTpl<double>>(
+                         A, -10. * Eigen::VectorXd::Ones(1)),
+                     NegativeOrthantTpl<double>{});
+  Problem problem(space, std::make_shared<RosenbrockCost>(100.), cstrs);
+
+  auto solve = [&](LSNonmonotone mode) {
+    ProxNLPSolverTpl<double> solver(problem, 1e-8, 1e-2, 0.);
+    solver.ls_options.nonmonotone = mode;
+    solver.setup();
+    Eigen::Vector2d x0(-1.2, 1.);
+    BOOST_CHECK_EQUAL(solver.solve(x0), ConvergenceFlag::SUCCESS);
+    BOOST_CHECK(solver.results_->x_opt.isApprox(Eigen::Vector2d::Ones(), 1e-6));
+    return solver.results_->num_iters;
+  };
+  // accepting steps which increase the merit function shortcuts the valley
+  const std::size_t num_iters_ref = solve(LSNonmonotone::NONE);
+  for (auto mode : {LSNonmonotone::MAX, LSNonmonotone::AVERAGE}) {
+    BOOST_CHECK_LT(solve(mode), num_iters_ref);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(trust_region_ill_conditioned) {
+  using Problem = ProblemTpl<double>;
+  const int nx = 6;
+  VectorSpaceTpl<double> space(nx);
+  // ill-conditioned cost
+  Eigen::VectorXd w = Eigen::VectorXd::LinSpaced(nx, 0., 8.).array().exp();
+  Eigen::MatrixXd W = w.asDiagonal();
+  Eigen::VectorXd target = Eigen::VectorXd::Ones(nx);
+  auto cost =
+      std::make_shared<QuadraticDistanceCostTpl<double>>(space, target, W);
+  Eigen::MatrixXd A = Eigen::MatrixXd::Random(2, nx);
+  Eigen::VectorXd b = Eigen::VectorXd::Random(2);
+  std::vector<Problem::ConstraintObject> cstrs;
+  cstrs.emplace_back(std::make_shared<LinearFunctionTpl<double>>(A, b),
+                     NegativeOrthantTpl<double>{});
+  Problem problem(space, cost, cstrs);
+
+  auto solve = [&](GlobalizationStrategy globalization) {
+    ProxNLPSolverTpl<double> solver(problem, 1e-8, 1e-2, 0.);
+    solver.globalization = globalization;
+    solver.setup();
+    Eigen::VectorXd x0 = space.neutral();
+    BOOST_CHECK_EQUAL(solver.solve(x0), ConvergenceFlag::SUCCESS);
+    return solver.results_->x_opt;
+  };
+  Eigen::VectorXd x_ref = solve(GlobalizationStrategy::LINESEARCH);
+  BOOST_CHECK(
+      solve(GlobalizationStrategy::TRUST_REGION).isApprox(x_ref, 1e-6));
+}
+
+/// Diagonal quadratic cost without mutable buffers, hence thread-safe.
+struct DiagonalQuadraticCost : CostFunctionBaseTpl<double> {
+  Eigen::VectorXd weights;
+  Eigen::VectorXd target;
+
+  DiagonalQuadraticCost(const Eigen::VectorXd &weights,
+                        const Eigen::VectorXd &target)
+      : CostFunctionBaseTpl<double>((int)target.size(), (int)target.size()),
+        weights(weights), target(target) {
+    this->thread_safe_ = true;
+  }
+
+  double call(const ConstVectorRef &x) const override {
+    return 0.5 * weights.dot((x - target).cwiseAbs2());
+  }
+  void computeGradient(const ConstVectorRef &x, VectorRef out) const override {
+    out = weights.cwiseProduct(x - target);
+  }
+  void computeHessian(const ConstVectorRef &, MatrixRef out) const override {
+    out.setZero();
+    out.diagonal() = weights;
+  }
+};
+
+/// Half-space constraints \f$Ax + b \leq 0\f$, active at the minimizer of
+/// a DiagonalQuadraticCost with target \f$(1,\ldots,1)\f$.
+std::vector<ProblemTpl<double>::ConstraintObject>
+halfspaceConstraints(const int nx) {
+  Eigen::MatrixXd A(2, nx);
+  A.row(0).setOnes();
+  A.row(1) = Eigen::VectorXd::LinSpaced(nx, -1., 1.);
+  Eigen::VectorXd b(2);
+  b << -1., 0.5;
+  std::vector<ProblemTpl<double>::ConstraintObject> cstrs;
+  cstrs.emplace_back(std::make_shared<LinearFunctionTpl<double>>(A, b),
+                     NegativeOrthantTpl<double>{});
+  return cstrs;
+}
+
+/// Records the points at which the gradient is evaluated.
+struct GradientCountingCost : DiagonalQuadraticCost {
+  mutable std::vector<Eigen::VectorXd> points;
+
+  using DiagonalQuadraticCost::DiagonalQuadraticCost;
+
+  void computeGradient(const ConstVectorRef &x, VectorRef out) const override {
+    points.push_back(x);
+    DiagonalQuadraticCost::computeGradient(x, out);
+  }
+
+  /// Number of evaluations at a point where the gradient was already
+  /// evaluated.
+  std::size_t numRepeated() const {
+    std::size_t n = 0;
+    for (std::size_t i = 0; i < points.size(); i++) {
+      for (std::size_t j = 0; j < i; j++) {
+        if (points[i] == points[j]) {
+          n++;
+          break;
+        }
+      }
+    }
+    return n;
+  }
+};
+
+BOOST_AUTO_TEST_CASE(wolfe_linesearch) {
+  using Problem = ProblemTpl<double>;
+  const int nx = 6;
+  VectorSpaceTpl<double> space(nx);
+  // ill-conditioned cost, so that the linesearch backtracks
+  Eigen::VectorXd w = Eigen::VectorXd::LinSpaced(nx, 0., 8.).array().exp();
+  auto cost =
+      std::make_shared<GradientCountingCost>(w, Eigen::VectorXd::Ones(nx));
+  Problem problem(space, cost, halfspaceConstraints(nx));
+
+  struct Outcome {
+    Eigen::VectorXd x_opt;
+    Eigen::VectorXd data_lams_opt;
+    std::size_t num_iters;
+    std::size_t al_iters;
+  };
+  auto solve = [&](LinesearchStrategy ls_strat) {
+    ProxNLPSolverTpl<double> solver(problem, 1e-8, 1e-2, 0.);
+    solver.ls_strat = ls_strat;
+    solver.setup();
+    cost->points.clear();
+    Eigen::VectorXd x0 = space.neutral();
+    BOOST_CHECK_EQUAL(solver.solve(x0), ConvergenceFlag::SUCCESS);
+    const auto &results = *solver.results_;
+    return Outcome{results.x_opt, results.data_lams_opt, results.num_iters,
+                   results.al_iters};
+  };
+  auto armijo = solve(LinesearchStrategy::ARMIJO);
+  auto wolfe = solve(LinesearchStrategy::WOLFE);
+  BOOST_CHECK(wolfe.x_opt.isApprox(armijo.x_opt, 1e-6));
+  BOOST_CHECK(wolfe.data_lams_opt.isApprox(armijo.data_lams_opt, 1e-6));
+  // the strong Wolfe linesearch evaluates the derivatives at each trial step,
+  // and those at the accepted step are reused for the next iteration: the
+  // only repeated evaluations are at the start of each inner loop
+  BOOST_CHECK_GT(wolfe.num_iters, 0);
+  BOOST_CHECK_GT(cost->points.size(), wolfe.num_iters);
+  BOOST_CHECK_EQUAL(cost->numRepeated(), wolfe.al_iters);
+}
+
+BOOST_AUTO_TEST_CASE(parallel_linesearch_trials) {
+  using Problem = ProblemTpl<double>;
+  const int nx = 6;
+  VectorSpaceTpl<double> space(nx);
+  Eigen::VectorXd w = Eigen::VectorXd::LinSpaced(nx, 0., 8.).array().exp();
+  auto cost = std::make_shared<DiagonalQuadraticCost>(
+      w, Eigen::VectorXd::Ones(nx));
+  Problem problem(space, cost, halfspaceConstraints(nx));
+  BOOST_CHECK(problem.isThreadSafe());
+
+  auto solve = [&](std::size_t parallel_trials) {
+    ProxNLPSolverTpl<double> solver(problem, 1e-8, 1e-2, 0.);
+    solver.setup();
+    // the trial workspaces are reallocated by solve()
+    solver.ls_options.parallel_trials = parallel_trials;
+    Eigen::VectorXd x0 = space.neutral();
+    BOOST_CHECK_EQUAL(solver.solve(x0), ConvergenceFlag::SUCCESS);
+    BOOST_CHECK_EQUAL(solver.trial_workspaces_.size(), parallel_trials - 1);
+    return solver.results_->x_opt;
+  };
+  const Eigen::VectorXd x_seq = solve(1);
+  const Eigen::VectorXd x_par = solve(4);
+  BOOST_CHECK(x_par.isApprox(x_seq, 1e-6));
+
+  // without the opt-in, the trials are evaluated one after the other, with
+  // the same results
+  cost->setThreadSafe(false);
+  BOOST_CHECK(!problem.isThreadSafe());
+  BOOST_CHECK(solve(4) == x_par);
+}
+
+/// Cost which cannot be evaluated away from the origin.
+struct OriginOnlyCost : DiagonalQuadraticCost {
+  using DiagonalQuadraticCost::DiagonalQuadraticCost;
+
+  double call(const ConstVectorRef &x) const override {
+    if (!x.isZero(0.))
+      return std::numeric_limits<double>::quiet_NaN();
+    return DiagonalQuadraticCost::call(x);
+  }
+};
+
+BOOST_AUTO_TEST_CASE(trust_region) {
+  using Problem = ProblemTpl<double>;
+  const int nx = 6;
+  VectorSpaceTpl<double> space(nx);
+  const Eigen::VectorXd w =
+      Eigen::VectorXd::LinSpaced(nx, 0., 2.).array().exp();
+  const Eigen::VectorXd target = Eigen::VectorXd::Ones(nx);
+  const auto cstrs = halfspaceConstraints(nx);
+  const Eigen::VectorXd x0 = space.neutral();
+
+  auto make_solver = [&](Problem &problem) {
+    auto solver = std::make_unique<ProxNLPSolverTpl<double>>(problem, 1e-8,
+                                                             1e-2, 0.);
+    solver->globalization = GlobalizationStrategy::TRUST_REGION;
+    solver->setup();
+    return solver;
+  };
+
+  Problem problem(space, std::make_shared<DiagonalQuadraticCost>(w, target),
+                  cstrs);
+  auto solver = make_solver(problem);
+  BOOST_CHECK_EQUAL(solver->solve(x0), ConvergenceFlag::SUCCESS);
+  solver->globalization = GlobalizationStrategy::LINESEARCH;
+  const Eigen::VectorXd x_tr = solver->results_->x_opt;
+  BOOST_CHECK_EQUAL(solver->solve(x0), ConvergenceFlag::SUCCESS);
+  BOOST_CHECK(x_tr.isApprox(solver->results_->x_opt, 1e-6));
+
+  // every trial step fails to evaluate: the steps are rejected, either once
+  // max_trials is reached or once the radius falls under radius_min, and the
+  // solve stops at the initial point
+  Problem bad_problem(space, std::make_shared<OriginOnlyCost>(w, target),
+                      cstrs);
+  for (std::size_t max_trials : {5, 100}) {
+    auto bad_solver = make_solver(bad_problem);
+    bad_solver->tr_params.max_trials = max_trials;
+    BOOST_CHECK_EQUAL(bad_solver->solve(x0),
+                      ConvergenceFlag::TRUST_REGION_FAILURE);
+    BOOST_CHECK_EQUAL(bad_solver->results_->num_iters, 0);
+    BOOST_CHECK_EQUAL(bad_solver->results_->al_iters, 0);
+    BOOST_CHECK(bad_solver->results_->x_opt == x0);
+    BOOST_CHECK(std::isfinite(bad_solver->results_->merit));
+  }
+}
+
+/// Projecting a point onto a cone by solving the corresponding problem
+/// exercises the dense projection Jacobians in the KKT system.
+BOOST_AUTO_TEST_CASE(cone_projection) {
+  using Problem = ProblemTpl<double>;
+  auto project = [](const auto &set, const Eigen::VectorXd &target,
+                    KktSystem kkt) {
+    const long n = target.size();
+    VectorSpaceTpl<double> space((int)n);
+    auto cost = std::make_shared<QuadraticDistanceCostTpl<double>>(
+        space, target, Eigen::MatrixXd::Identity(n, n));
+    auto res = std::make_shared<LinearFunctionTpl<double>>(
+        Eigen::MatrixXd::Identity(n, n), Eigen::VectorXd::Zero(n));
+    std::vector<Problem::ConstraintObject> cstrs;
+    cstrs.emplace_back(res, set);
+    Problem problem(space, cost, cstrs);
+
+    ProxNLPSolverTpl<double> solver(problem, 1e-10, 1e-2, 0.);
+    solver.kkt_system_ = kkt;
+    solver.setup();
+    Eigen::VectorXd x0 = space.neutral();
+    BOOST_CHECK_EQUAL(solver.solve(x0), ConvergenceFlag::SUCCESS);
+    Eigen::VectorXd xproj(n);
+    set.projection(target, xproj);
+    BOOST_CHECK(solver.results_->x_opt.isApprox(xproj, 1e-6));
+  };
+
+  Eigen::VectorXd target(4);
+  target << 0.5, 1., -2., 0.3;
+  Eigen::MatrixXd A = Eigen::MatrixXd::Random(3, 3);
+  Eigen::MatrixXd Z = A + A.transpose();
+  Eigen::VectorXd ztarget = Eigen::Map<Eigen::VectorXd>(Z.data(), 9);
+  for (KktSystem kkt : {KKT_CLASSIC, KKT_PRIMAL_DUAL}) {
+    project(SecondOrderConeTpl<double>{}, target, kkt);
+    project(PositiveSemidefiniteConeTpl<double>(3), ztarget, kkt);
+  }
+}
+
+/// Dogleg path on the plane of a steepest descent and a Newton direction.
+BOOST_AUTO_TEST_CASE(dogleg) {
+  // model m(p) = g^T p + 0.5 p^T B p with B = diag(1, 4)
+  Eigen::Vector2d g(1., 2.);
+  Eigen::Matrix2d B = Eigen::Vector2d(1., 4.).asDiagonal();
+  Eigen::Vector2d d = -B.inverse() * g;
+  DoglegTpl<double> dogleg(g.squaredNorm(), g.dot(d), d.squaredNorm(),
+                           g.dot(B * g));
+  auto model = [&](const Eigen::Vector2d &p) {
+    return g.dot(p) + 0.5 * p.dot(B * p);
+  };
+
+  double u, v;
+  // Newton step inside the trust region
+  dogleg.compute(2., u, v);
+  BOOST_CHECK_EQUAL(u, 0.);
+  BOOST_CHECK_EQUAL(v, 1.);
+  for (double radius : {1e-2, 0.5, 1.}) {
+    dogleg.compute(radius, u, v);
+    Eigen::Vector2d p = -u * g + v * d;
+    BOOST_CHECK_CLOSE(p.norm(), radius, 1e-8);
+    BOOST_CHECK_CLOSE(dogleg.norm(u, v), radius, 1e-8);
+    BOOST_CHECK_CLOSE(dogleg.model(u, v), model(p), 1e-8);
+    BOOST_CHECK_LT(dogleg.model(u, v), 0.);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(jacobian_columns_after_setup) {
+  using Problem = ProblemTpl<double>;
+  const int nx = 6;
+  VectorSpaceTpl<double> space(nx);
+  auto cost = std::make_shared<QuadraticDistanceCostTpl<double>>(
+      space, Eigen::VectorXd::Random(nx), Eigen::MatrixXd::Identity(nx, nx));
+  Eigen::MatrixXd A = Eigen::MatrixXd::Zero(2, nx);
+  A.middleCols(2, 3).setRandom();
+  auto res = std::make_shared<LinearFunctionTpl<double>>(
+      A, Eigen::VectorXd::Random(2));
+  std::vector<Problem::ConstraintObject> cstrs;
+  cstrs.emplace_back(res, EqualityConstraintTpl<double>{});
+  Problem problem(space, cost, cstrs);
+  BOOST_CHECK(!problem.hasSparseJacobians());
+
+  // declared after the problem is built, before setup()
+  res->setJacobianColumns(2, 3);
+  BOOST_CHECK(problem.hasSparseJacobians());
+  ProxNLPSolverTpl<double> solver(problem, 1e-8, 1e-2, 0.);
+  solver.setup();
+  Eigen::VectorXd x0 = space.neutral();
+  BOOST_CHECK_EQUAL(solver.solve(x0), ConvergenceFlag::SUCCESS);
+
+  // the workspace batches are stale until setup() is called again
+  res->setJacobianColumns(0, nx);
+  BOOST_CHECK(!problem.hasSparseJacobians());
+  BOOST_CHECK_THROW(solver.solve(x0), std::runtime_error);
+  solver.setup();
+  BOOST_CHECK_EQUAL(solver.solve(x0), ConvergenceFlag::SUCCESS);
+}
+
+BOOST_AUTO_TEST_CASE(constraint_sets_after_setup) {
+  using Problem = ProblemTpl<double>;
+  using Box = BoxConstraintTpl<double>;
+  const int nx = 3;
+  VectorSpaceTpl<double> space(nx);
+  auto cost = std::make_shared<QuadraticDistanceCostTpl<double>>(
+      space, 5. * Eigen::VectorXd::Ones(nx), Eigen::MatrixXd::Identity(nx, nx));
+  auto res = std::make_shared<LinearFunctionTpl<double>>(
+      Eigen::MatrixXd::Identity(nx, nx), Eigen::VectorXd::Zero(nx));
+  std::vector<Problem::ConstraintObject> cstrs;
+  cstrs.emplace_back(res, Box(-Eigen::VectorXd::Ones(nx),
+                              Eigen::VectorXd::Ones(nx)));
+  Problem problem(space, cost, cstrs);
+  ProxNLPSolverTpl<double> solver(problem, 1e-8, 1e-2, 0.);
+  solver.setup();
+  Eigen::VectorXd x0 = space.neutral();
+  BOOST_CHECK_EQUAL(solver.solve(x0), ConvergenceFlag::SUCCESS);
+  BOOST_CHECK(solver.results_->x_opt.isApprox(Eigen::VectorXd::Ones(nx), 1e-6));
+
+  // edit the set in place, as the Python bindings allow, without setup()
+  auto &box = const_cast<Box &>(
+      static_cast<const Box &>(*problem.getConstraint(0).set_));
+  box.upper_limit.setConstant(2.);
+  BOOST_CHECK_EQUAL(solver.solve(x0), ConvergenceFlag::SUCCESS);
+  BOOST_CHECK(
+      solver.results_->x_opt.isApprox(2. * Eigen::VectorXd::Ones(nx), 1e-6));
+}
+
 BOOST_AUTO_TEST_SUITE_END()